@@ -0,0 +1,1081 @@
+/*****************************************************************************/
+/*                                                                           */
+/*!     @brief Benchmark of the command line option parser                  */
+/*                                                                           */
+/*  Measures the parse throughput in dependence of the size of the option    */
+/*  block-list and the length of the argument vector, for each lookup        */
+/*  engine, the scaling of parseCommandLineBatch() in dependence of the      */
+/*  number of threads and the time of printOptionList().                     */
+/*  The results becomes written as CSV in stdout.                            */
+/*  By option --verify it compares the vectorized long option matchers with  */
+/*  the scalar one and checks the unique-prefix matching instead.            */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*! @file    clop_bench.c                                                    */
+/*! @see     parse_opts.h                                                    */
+/*! @author  Ulrich Becker                                                   */
+/*! @date    16.10.2026                                                      */
+/*****************************************************************************/
+/*
+ * MIT License
+ *
+ * Copyright (c) 2016 Ulrich Becker
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <parse_opts.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#define MAX_LIST_ITEMS 16
+#define BATCH_SIZE     4096
+
+#define VERIFY_ROUNDS     20000
+#define VERIFY_MAX_BLOCKS 200
+#define VERIFY_MAX_ARGS   48
+
+static const char g_shortChars[] =
+   "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+/*!----------------------------------------------------------------------------
+ * @brief A list of numbers given by a comma separated option argument.
+ */
+struct NUMBER_LIST_T
+{
+   unsigned int number[MAX_LIST_ITEMS];
+   unsigned int count;
+};
+
+/*!----------------------------------------------------------------------------
+ * @brief The program variables which becomes modified by the options.
+ */
+struct BENCH_T
+{
+   struct NUMBER_LIST_T tableSizes;
+   struct NUMBER_LIST_T argvLengths;
+   struct NUMBER_LIST_T threads;
+   unsigned int         minTimeMs;
+   unsigned int         seed;
+   bool                 noLinear;
+   bool                 verify;
+};
+
+/*!----------------------------------------------------------------------------
+ * @brief Synthetic option block-list with its synthetic argument vectors.
+ */
+struct SYNTHETIC_T
+{
+   struct OPTION_BLOCK_T* pBlockList;
+   char*                  pNames;
+   unsigned int           size;
+   char**                 ppArgv;
+   char*                  pArgStrings;
+   int                    argc;
+   unsigned int           numOfArgs; //!<@brief Number of arguments without ppArgv[0].
+};
+
+/*!----------------------------------------------------------------------------
+ * @brief Lookup engine to benchmark.
+ */
+struct ENGINE_T
+{
+   const char*   name;
+   int  (*setup)( struct SYNTHETIC_T* pSyn, void** ppState );
+   int  (*parse)( struct SYNTHETIC_T* pSyn, void* pState );
+   void (*teardown)( void* pState );
+   OPT_MATCHER_T matcher; //!<@brief Matcher of the long options without table.
+};
+
+static volatile unsigned long g_hits;
+
+/*-----------------------------------------------------------------------------
+*/
+static inline uint64_t nanoTime( void )
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+   return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optHit( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   if( pArg->pUser != NULL )
+   {  /* Private counter of a batch item, no shared write. */
+      (*(unsigned long*)pArg->pUser)++;
+      return 0;
+   }
+   g_hits++;
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int readNumberList( struct BLOCK_FUNCTION_ARG_T* pArg, struct NUMBER_LIST_T* pList )
+{
+   const char* pC = pArg->optArg;
+   char* pEnd;
+
+   pList->count = 0;
+   while( *pC != '\0' )
+   {
+      if( pList->count == MAX_LIST_ITEMS )
+         break;
+      pList->number[pList->count] = strtoul( pC, &pEnd, 10 );
+      if( (pEnd == pC) || ((*pEnd != ',') && (*pEnd != '\0')) )
+      {
+         fprintf( stderr, "%s: invalid number list for option \"", pArg->ppAgv[0] );
+         printOption( stderr, pArg->pCurrentBlock );
+         fprintf( stderr, "\": \"%s\"\n", pArg->optArg );
+         return -1;
+      }
+      pList->count++;
+      pC = (*pEnd == ',')? pEnd + 1 : pEnd;
+   }
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optTableSizes( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   return readNumberList( pArg, &((struct BENCH_T*)pArg->pUser)->tableSizes );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optArgvLengths( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   return readNumberList( pArg, &((struct BENCH_T*)pArg->pUser)->argvLengths );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optThreads( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   return readNumberList( pArg, &((struct BENCH_T*)pArg->pUser)->threads );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optMinTime( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   ((struct BENCH_T*)pArg->pUser)->minTimeMs = strtoul( pArg->optArg, NULL, 10 );
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optSeed( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   ((struct BENCH_T*)pArg->pUser)->seed = strtoul( pArg->optArg, NULL, 10 );
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optNoLinear( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   ((struct BENCH_T*)pArg->pUser)->noLinear = true;
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optVerify( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   ((struct BENCH_T*)pArg->pUser)->verify = true;
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optPrintHelp( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   printf( "Benchmark of the command line option parser.\n\n"
+           "Usage: %s [options]\nOptions:\n", pArg->ppAgv[0] );
+   printOptionList( stdout, pArg->pOptBlockList );
+   printf( "Output: CSV in stdout with the columns\n"
+           "benchmark,engine,table_size,argc,iterations,total_ns,ns_per_item\n"
+           "The items of ns_per_item are the arguments by the benchmarks \"parse\"\n"
+           "and \"batch\" (engine \"threads-N\", %u command lines per batch),\n"
+           "the option blocks by \"setup\" and \"print_option_list\".\n", BATCH_SIZE );
+   exit( EXIT_SUCCESS );
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void* allocate( size_t size )
+{
+   void* p = malloc( size );
+   if( p == NULL )
+   {
+      fprintf( stderr, "clop_bench: out of memory\n" );
+      exit( EXIT_FAILURE );
+   }
+   return p;
+}
+
+/*-----------------------------------------------------------------------------
+ * Makes a block-list with mixed option types. The long option names have
+ * common prefixes like real option sets, the first blocks get a short option
+ * as well.
+ */
+static void makeBlockList( struct SYNTHETIC_T* pSyn, unsigned int size )
+{
+   static const char* prefixes[] = { "enable-", "disable-", "with-", "log-", "" };
+   const size_t nameSize = 32;
+   unsigned int i;
+   ARG_REQUIRE_T hasArg;
+
+   pSyn->size       = size;
+   pSyn->pBlockList = allocate( (size + 1) * sizeof( struct OPTION_BLOCK_T ) );
+   pSyn->pNames     = allocate( size * nameSize );
+
+   for( i = 0; i < size; i++ )
+   {
+      char* pName = &pSyn->pNames[i * nameSize];
+      snprintf( pName, nameSize, "%sfeature-%u", prefixes[i % 5], i );
+      switch( i % 3 )
+      {
+         case 0:  hasArg = NO_ARG;       break;
+         case 1:  hasArg = REQUIRED_ARG; break;
+         default: hasArg = OPTIONAL_ARG; break;
+      }
+      /* Constant members can only be set by a initializer. */
+      struct OPTION_BLOCK_T block =
+      {
+         .optFunction = optHit,
+         .hasArg      = hasArg,
+         .id          = i,
+         .shortOpt    = (i < (sizeof( g_shortChars ) - 1))? g_shortChars[i] : 0,
+         .longOpt     = pName,
+         .helpText    = "Synthetic option of the benchmark.\nSecond line of the help text."
+      };
+      memcpy( &pSyn->pBlockList[i], &block, sizeof( block ) );
+   }
+   memset( &pSyn->pBlockList[size], 0, sizeof( struct OPTION_BLOCK_T ) );
+}
+
+/*-----------------------------------------------------------------------------
+ * Makes a argument vector with randomly chosen options in all spellings.
+ */
+static void makeArgv( struct SYNTHETIC_T* pSyn, unsigned int numOfArgs )
+{
+   const size_t argSize = 48;
+   unsigned int n = 0;
+   const struct OPTION_BLOCK_T* pBlock;
+
+   pSyn->ppArgv      = allocate( (numOfArgs + 2) * sizeof( char* ) );
+   pSyn->pArgStrings = allocate( (numOfArgs + 1) * argSize );
+   pSyn->ppArgv[0] = "clop_bench";
+
+   while( n < numOfArgs )
+   {
+      char* pArg = &pSyn->pArgStrings[n * argSize];
+      pBlock = &pSyn->pBlockList[rand() % pSyn->size];
+      bool useShort = (pBlock->shortOpt != 0) && ((rand() % 4) == 0);
+
+      switch( pBlock->hasArg )
+      {
+         case NO_ARG:
+         {
+            if( useShort )
+               snprintf( pArg, argSize, "-%c", pBlock->shortOpt );
+            else
+               snprintf( pArg, argSize, "--%s", pBlock->longOpt );
+            break;
+         }
+         case REQUIRED_ARG:
+         {
+            if( n + 2 > numOfArgs )
+               continue;
+            if( useShort )
+               snprintf( pArg, argSize, "-%c", pBlock->shortOpt );
+            else
+               snprintf( pArg, argSize, "--%s", pBlock->longOpt );
+            pSyn->ppArgv[++n] = pArg;
+            pArg = &pSyn->pArgStrings[n * argSize];
+            snprintf( pArg, argSize, "value%u", n );
+            break;
+         }
+         default:
+         {
+            if( useShort )
+               snprintf( pArg, argSize, "-%c=value%u", pBlock->shortOpt, n );
+            else
+               snprintf( pArg, argSize, "--%s=value%u", pBlock->longOpt, n );
+            break;
+         }
+      }
+      pSyn->ppArgv[++n] = pArg;
+   }
+   pSyn->ppArgv[n + 1] = NULL;
+   pSyn->argc      = n + 1;
+   pSyn->numOfArgs = n;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void freeArgv( struct SYNTHETIC_T* pSyn )
+{
+   free( pSyn->pArgStrings );
+   free( pSyn->ppArgv );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int parseLinear( struct SYNTHETIC_T* pSyn, void* pState )
+{
+   (void)pState;
+   return parseCommandLineOptions( pSyn->argc, pSyn->ppArgv, pSyn->pBlockList, NULL );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int setupTable( struct SYNTHETIC_T* pSyn, void** ppState )
+{
+   struct OPTION_TABLE_T* pTable = allocate( sizeof( struct OPTION_TABLE_T ) );
+   if( initOptionTable( pTable, pSyn->pBlockList ) < 0 )
+      return -1;
+   *ppState = pTable;
+   return 0;
+}
+
+static int parseTable( struct SYNTHETIC_T* pSyn, void* pState )
+{
+   return parseCommandLineOptionsTable( pSyn->argc, pSyn->ppArgv,
+                                        (struct OPTION_TABLE_T*)pState, NULL );
+}
+
+static void teardownTable( void* pState )
+{
+   freeOptionTable( (struct OPTION_TABLE_T*)pState );
+   free( pState );
+}
+
+/*-----------------------------------------------------------------------------
+ * Like the engine "table" but by the option iterator without callback, so
+ * the time is the lookup time nearly alone.
+ */
+static int parseIterator( struct SYNTHETIC_T* pSyn, void* pState )
+{
+   struct OPTION_ITERATOR_T it;
+   OPT_ITER_RESULT_T result;
+
+   initOptionIteratorTable( &it, 1, pSyn->argc, pSyn->ppArgv,
+                            (struct OPTION_TABLE_T*)pState );
+   while( (result = parseNextOption( &it )) == OPT_ITER_FOUND )
+      g_hits++;
+   return (result == OPT_ITER_END)? it.argvIndex : -1;
+}
+
+/*-----------------------------------------------------------------------------
+ * Like the engine "table" but all options are counters which becomes
+ * stored inline by the parser without callback.
+ */
+struct INLINE_STATE_T
+{
+   struct OPTION_TABLE_T  table;
+   struct OPTION_BLOCK_T* pBlockList;
+   int                    counter;
+};
+
+static int setupInline( struct SYNTHETIC_T* pSyn, void** ppState )
+{
+   struct INLINE_STATE_T* pState = allocate( sizeof( struct INLINE_STATE_T ) );
+   unsigned int i;
+
+   pState->pBlockList = allocate( (pSyn->size + 1) * sizeof( struct OPTION_BLOCK_T ) );
+   memcpy( pState->pBlockList, pSyn->pBlockList,
+           (pSyn->size + 1) * sizeof( struct OPTION_BLOCK_T ) );
+   for( i = 0; i < pSyn->size; i++ )
+   {
+      pState->pBlockList[i].optFunction = storeOptionValue;
+      pState->pBlockList[i].valueType   = OPT_TYPE_COUNTER;
+      pState->pBlockList[i].valueOffset = offsetof( struct INLINE_STATE_T, counter );
+   }
+   pState->counter = 0;
+   if( initOptionTable( &pState->table, pState->pBlockList ) < 0 )
+      return -1;
+   *ppState = pState;
+   return 0;
+}
+
+static int parseInline( struct SYNTHETIC_T* pSyn, void* pState )
+{
+   return parseCommandLineOptionsTable( pSyn->argc, pSyn->ppArgv,
+                                        &((struct INLINE_STATE_T*)pState)->table,
+                                        pState );
+}
+
+static void teardownInline( void* pState )
+{
+   freeOptionTable( &((struct INLINE_STATE_T*)pState)->table );
+   free( ((struct INLINE_STATE_T*)pState)->pBlockList );
+   free( pState );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static const struct ENGINE_T g_engines[] =
+{
+   { "linear",        NULL,        parseLinear,   NULL,           OPT_MATCHER_AUTO   },
+   { "linear-sse2",   NULL,        parseLinear,   NULL,           OPT_MATCHER_SSE2   },
+   { "linear-scalar", NULL,        parseLinear,   NULL,           OPT_MATCHER_SCALAR },
+   { "table",         setupTable,  parseTable,    teardownTable,  OPT_MATCHER_AUTO   },
+   { "iterator",      setupTable,  parseIterator, teardownTable,  OPT_MATCHER_AUTO   },
+   { "inline",        setupInline, parseInline,   teardownInline, OPT_MATCHER_AUTO   },
+};
+
+/*-----------------------------------------------------------------------------
+*/
+static void printResult( const char* benchmark, const char* engine,
+                         struct SYNTHETIC_T* pSyn, unsigned long iterations,
+                         uint64_t totalNs, unsigned int perIteration )
+{
+   printf( "%s,%s,%u,%d,%lu,%llu,%.2f\n",
+           benchmark, engine, pSyn->size, pSyn->argc, iterations,
+           (unsigned long long)totalNs,
+           (perIteration == 0)? 0.0 :
+                 (double)totalNs / ((double)iterations * perIteration) );
+   fflush( stdout );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int benchParse( struct BENCH_T* pBench, struct SYNTHETIC_T* pSyn,
+                       const struct ENGINE_T* pEngine )
+{
+   void* pState = NULL;
+   unsigned long iterations = 0;
+   uint64_t start, now, setupNs = 0;
+   const uint64_t minNs = (uint64_t)pBench->minTimeMs * 1000000ULL;
+
+   if( (selectOptionMatcher( pEngine->matcher ) != pEngine->matcher) &&
+       (pEngine->matcher != OPT_MATCHER_AUTO) )
+      return 0; /* Not supported by this processor. */
+
+   if( pEngine->setup != NULL )
+   {
+      start = nanoTime();
+      if( pEngine->setup( pSyn, &pState ) != 0 )
+      {
+         fprintf( stderr, "clop_bench: setup of engine %s failed\n", pEngine->name );
+         return -1;
+      }
+      setupNs = nanoTime() - start;
+   }
+
+   start = nanoTime();
+   do
+   {
+      if( pEngine->parse( pSyn, pState ) != pSyn->argc )
+      {
+         fprintf( stderr, "clop_bench: parse error by engine %s\n", pEngine->name );
+         return -1;
+      }
+      iterations++;
+      now = nanoTime();
+   }
+   while( (now - start) < minNs );
+
+   if( pEngine->teardown != NULL )
+   {
+      pEngine->teardown( pState );
+      printResult( "setup", pEngine->name, pSyn, 1, setupNs, pSyn->size );
+   }
+   printResult( "parse", pEngine->name, pSyn, iterations, now - start, pSyn->numOfArgs );
+   selectOptionMatcher( OPT_MATCHER_AUTO );
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ * All items of the batch are the same synthetic command line, each one with
+ * its own hit counter as user tunnel.
+ */
+static int benchBatch( struct BENCH_T* pBench, struct SYNTHETIC_T* pSyn )
+{
+   struct OPTION_TABLE_T table;
+   struct OPTION_BATCH_ITEM_T* pItems;
+   unsigned long* pCounters;
+   unsigned long iterations;
+   uint64_t start, now;
+   const uint64_t minNs = (uint64_t)pBench->minTimeMs * 1000000ULL;
+   char engine[32];
+   unsigned int t, i;
+   int ret = 0;
+
+   if( initOptionTable( &table, pSyn->pBlockList ) < 0 )
+      return -1;
+   pItems    = allocate( BATCH_SIZE * sizeof( struct OPTION_BATCH_ITEM_T ) );
+   pCounters = allocate( BATCH_SIZE * sizeof( unsigned long ) );
+   for( i = 0; i < BATCH_SIZE; i++ )
+   {
+      pItems[i].argc   = pSyn->argc;
+      pItems[i].ppArgv = pSyn->ppArgv;
+      pItems[i].pUser  = &pCounters[i];
+      pItems[i].pErrorSink = NULL;
+   }
+
+   for( t = 0; (t < pBench->threads.count) && (ret == 0); t++ )
+   {
+      iterations = 0;
+      start = nanoTime();
+      do
+      {
+         parseCommandLineBatch( pItems, BATCH_SIZE, &table,
+                                pBench->threads.number[t] );
+         for( i = 0; i < BATCH_SIZE; i++ )
+         {
+            if( pItems[i].result != pSyn->argc )
+            {
+               fprintf( stderr, "clop_bench: parse error by batch item %u\n", i );
+               ret = -1;
+               break;
+            }
+         }
+         iterations++;
+         now = nanoTime();
+      }
+      while( (ret == 0) && ((now - start) < minNs) );
+
+      if( ret == 0 )
+      {
+         snprintf( engine, sizeof( engine ), "threads-%u", pBench->threads.number[t] );
+         printResult( "batch", engine, pSyn, iterations, now - start,
+                      pSyn->numOfArgs * BATCH_SIZE );
+      }
+   }
+
+   free( pCounters );
+   free( pItems );
+   freeOptionTable( &table );
+   return ret;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int benchPrintOptionList( struct BENCH_T* pBench, struct SYNTHETIC_T* pSyn )
+{
+   unsigned long iterations = 0;
+   uint64_t start, now;
+   const uint64_t minNs = (uint64_t)pBench->minTimeMs * 1000000ULL;
+   FILE* pNull = fopen( "/dev/null", "w" );
+
+   if( pNull == NULL )
+   {
+      perror( "/dev/null" );
+      return -1;
+   }
+   start = nanoTime();
+   do
+   {
+      printOptionList( pNull, pSyn->pBlockList );
+      fflush( pNull );
+      iterations++;
+      now = nanoTime();
+   }
+   while( (now - start) < minNs );
+   fclose( pNull );
+
+   printResult( "print_option_list", "stdio", pSyn, iterations, now - start, pSyn->size );
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ * Differential test of the long option matchers: random block-lists with
+ * names of common prefixes and lengths around 8 characters, random argument
+ * vectors with hits, near misses and all spellings, parsed by
+ * OPT_MATCHER_SCALAR and by each vectorized matcher. All recorded callbacks,
+ * errors and return values has to be identical.
+ */
+struct VERIFY_RECORD_T
+{
+   int         block;
+   int         argvIndex;
+   const char* optArg;
+};
+
+struct VERIFY_RESULT_T
+{
+   int                        ret;
+   unsigned int               numOfRecords;
+   struct VERIFY_RECORD_T     records[VERIFY_MAX_ARGS];
+   struct OPTION_ERROR_T      errors[VERIFY_MAX_ARGS];
+   struct OPTION_ERROR_SINK_T errorSink;
+};
+
+struct VERIFY_T
+{
+   struct OPTION_BLOCK_T blockList[VERIFY_MAX_BLOCKS + 1];
+   char*                 pNames[VERIFY_MAX_BLOCKS];
+   unsigned int          size;
+   char*                 ppArgv[VERIFY_MAX_ARGS + 1];
+   char*                 pArgMemory[VERIFY_MAX_ARGS];
+   int                   argc;
+};
+
+static const char* g_matcherNames[] = { "auto", "scalar", "sse2", "avx2" };
+
+/*-----------------------------------------------------------------------------
+*/
+static int optRecord( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   struct VERIFY_RESULT_T* pResult = pArg->pUser;
+   struct VERIFY_RECORD_T* pRecord = &pResult->records[pResult->numOfRecords++];
+
+   pRecord->block     = pArg->pCurrentBlock - pArg->pOptBlockList;
+   pRecord->argvIndex = pArg->argvIndex;
+   pRecord->optArg    = pArg->optArg;
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ * Name of a common prefix with a random tail of 'a' and 'b', rarely one of
+ * 'a' only around the clipped length of the packed keys, so the arguments
+ * shorter or longer by one character have the same key.
+ */
+static char* makeVerifyName( void )
+{
+   static const char* prefixes[] = { "", "a", "option-", "options-", "aaaaaaaa" };
+   const char* prefix = prefixes[rand() % 5];
+   size_t len = strlen( prefix ) + rand() % 12;
+   char* pName;
+   size_t i;
+
+   if( (rand() % 200) == 0 )
+   {
+      len = 0xFFFD + rand() % 4;
+      pName = allocate( len + 1 );
+      memset( pName, 'a', len );
+      pName[len] = '\0';
+      return pName;
+   }
+   pName = allocate( len + 1 );
+   memcpy( pName, prefix, strlen( prefix ) );
+   for( i = strlen( prefix ); i < len; i++ )
+      pName[i] = ((rand() % 4) == 0)? 'b' : 'a';
+   pName[len] = '\0';
+   return pName;
+}
+
+/*-----------------------------------------------------------------------------
+ * Copies the argument at a random alignment, so the vectorized scan for the
+ * '=' becomes tested by all alignments.
+ */
+static void addVerifyArgument( struct VERIFY_T* pV, const char* pPrefix,
+                               const char* pName, size_t nameLen,
+                               const char* pSuffix )
+{
+   size_t prefixLen = strlen( pPrefix );
+   size_t suffixLen = strlen( pSuffix );
+   size_t offset = rand() % 16;
+   char* pMemory = allocate( offset + prefixLen + nameLen + suffixLen + 1 );
+   char* pArg = pMemory + offset;
+
+   memcpy( pArg, pPrefix, prefixLen );
+   memcpy( pArg + prefixLen, pName, nameLen );
+   memcpy( pArg + prefixLen + nameLen, pSuffix, suffixLen + 1 );
+   pV->pArgMemory[pV->argc - 1] = pMemory;
+   pV->ppArgv[pV->argc++] = pArg;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void makeVerifyRound( struct VERIFY_T* pV )
+{
+   static const ARG_REQUIRE_T argKinds[] = { NO_ARG, REQUIRED_ARG, OPTIONAL_ARG };
+   const int numOfArgs = 1 + rand() % (VERIFY_MAX_ARGS - 1);
+   unsigned int i;
+
+   pV->size = 1 + rand() % VERIFY_MAX_BLOCKS;
+   for( i = 0; i < pV->size; i++ )
+   {
+      if( (i > 0) && ((rand() % 16) == 0) )  /* Duplicate, the first one wins. */
+         pV->pNames[i] = strdup( pV->pNames[rand() % i] );
+      else
+         pV->pNames[i] = makeVerifyName();
+      struct OPTION_BLOCK_T block =
+      {
+         .optFunction = optRecord,
+         .hasArg      = argKinds[rand() % 3],
+         .id          = i,
+         .longOpt     = ((rand() % 20) == 0)? NULL : pV->pNames[i]
+      };
+      memcpy( &pV->blockList[i], &block, sizeof( block ) );
+   }
+   memset( &pV->blockList[pV->size], 0, sizeof( struct OPTION_BLOCK_T ) );
+
+   pV->ppArgv[0] = "clop_bench";
+   pV->argc = 1;
+   while( pV->argc <= numOfArgs )
+   {
+      const char* pName = pV->pNames[rand() % pV->size];
+      size_t len = strlen( pName );
+      switch( rand() % 16 )
+      {
+         case 0: case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+            addVerifyArgument( pV, "--", pName, len, "" );
+            break;
+         case 9:
+            addVerifyArgument( pV, "--", pName, len, "=value" );
+            break;
+         case 10:
+            addVerifyArgument( pV, "--", pName, len, "=" );
+            break;
+         case 11: /* Shorter or longer by one character. */
+            if( (len > 0) && ((rand() % 2) == 0) )
+               addVerifyArgument( pV, "--", pName, len - 1, "" );
+            else
+               addVerifyArgument( pV, "--", pName, len, ((rand() % 2) == 0)? "a" : "b" );
+            break;
+         case 12: /* Same length, other last character. */
+         {
+            char* pCopy = strdup( pName );
+            if( len > 0 )
+               pCopy[len - 1] = (pCopy[len - 1] == 'a')? 'b' : 'a';
+            addVerifyArgument( pV, "--", pCopy, len, "" );
+            free( pCopy );
+            break;
+         }
+         case 13:
+            addVerifyArgument( pV, "--", pName, len, " =value" );
+            break;
+         case 14:
+            addVerifyArgument( pV, "", "=", 1, ((rand() % 2) == 0)? "value" : "" );
+            break;
+         default:
+            if( (rand() % 8) == 0 )
+               addVerifyArgument( pV, "--", "", 0, "=value" );
+            else
+               addVerifyArgument( pV, "", "value", 5, "" );
+            break;
+      }
+   }
+   pV->ppArgv[pV->argc] = NULL;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void freeVerifyRound( struct VERIFY_T* pV )
+{
+   unsigned int i;
+   int a;
+
+   for( i = 0; i < pV->size; i++ )
+      free( pV->pNames[i] );
+   for( a = 1; a < pV->argc; a++ )
+      free( pV->pArgMemory[a - 1] );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void parseVerifyRound( struct VERIFY_T* pV, struct VERIFY_RESULT_T* pResult )
+{
+   struct OPTION_CONTEXT_T context =
+   {
+      .pOptBlockList = pV->blockList,
+      .pErrorSink    = &pResult->errorSink,
+      .pUser         = pResult
+   };
+
+   memset( pResult, 0, sizeof( *pResult ) );
+   pResult->errorSink.pErrors  = pResult->errors;
+   pResult->errorSink.capacity = VERIFY_MAX_ARGS;
+   pResult->ret = parseCommandLineContextAt( 1, pV->argc, pV->ppArgv, &context );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static bool isSameResult( const struct VERIFY_RESULT_T* pR1,
+                          const struct VERIFY_RESULT_T* pR2 )
+{
+   size_t i;
+
+   if( (pR1->ret != pR2->ret) || (pR1->numOfRecords != pR2->numOfRecords) ||
+       (pR1->errorSink.count != pR2->errorSink.count) )
+      return false;
+   for( i = 0; i < pR1->numOfRecords; i++ )
+   {
+      if( (pR1->records[i].block     != pR2->records[i].block)     ||
+          (pR1->records[i].argvIndex != pR2->records[i].argvIndex) ||
+          (pR1->records[i].optArg    != pR2->records[i].optArg) )
+         return false;
+   }
+   for( i = 0; i < pR1->errorSink.count; i++ )
+   {
+      if( (pR1->errors[i].code        != pR2->errors[i].code)        ||
+          (pR1->errors[i].argvIndex   != pR2->errors[i].argvIndex)   ||
+          (pR1->errors[i].pToken      != pR2->errors[i].pToken)      ||
+          (pR1->errors[i].tokenLength != pR2->errors[i].tokenLength) ||
+          (pR1->errors[i].pBlock      != pR2->errors[i].pBlock) )
+         return false;
+   }
+   return true;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int verifyMatchers( void )
+{
+   static struct VERIFY_T verify;
+   static struct VERIFY_RESULT_T expected, result;
+   unsigned long parses[OPT_MATCHER_AVX2 + 1] = { 0 };
+   unsigned long options = 0;
+   unsigned int round, m;
+   int a;
+
+   for( round = 0; round < VERIFY_ROUNDS; round++ )
+   {
+      makeVerifyRound( &verify );
+      selectOptionMatcher( OPT_MATCHER_SCALAR );
+      parseVerifyRound( &verify, &expected );
+      options += expected.numOfRecords + expected.errorSink.count;
+
+      for( m = OPT_MATCHER_SSE2; m <= OPT_MATCHER_AVX2; m++ )
+      {
+         if( selectOptionMatcher( m ) != m )
+            continue;
+         parseVerifyRound( &verify, &result );
+         parses[m]++;
+         if( isSameResult( &expected, &result ) )
+            continue;
+         fprintf( stderr, "clop_bench: matcher %s differs from scalar in round %u "
+                          "(%u blocks), return value %d instead of %d, arguments:\n",
+                  g_matcherNames[m], round, verify.size, result.ret, expected.ret );
+         for( a = 1; a < verify.argc; a++ )
+            fprintf( stderr, "  [%d] \"%.80s\"\n", a, verify.ppArgv[a] );
+         return EXIT_FAILURE;
+      }
+      freeVerifyRound( &verify );
+   }
+   selectOptionMatcher( OPT_MATCHER_AUTO );
+
+   for( m = OPT_MATCHER_SSE2; m <= OPT_MATCHER_AVX2; m++ )
+   {
+      printf( "verify,%s,%lu parses,%s\n", g_matcherNames[m], parses[m],
+              (parses[m] != 0)? "identical to scalar" : "not supported" );
+   }
+   printf( "verify,scalar,%u parses,%lu options and errors\n", VERIFY_ROUNDS, options );
+   return EXIT_SUCCESS;
+}
+
+/*-----------------------------------------------------------------------------
+ * Checks the unique-prefix matching of the compiled table by fixed cases,
+ * the empty name of "--=value" must not match as prefix.
+ */
+static int verifyPrefixMatching( void )
+{
+   static const struct
+   {
+      unsigned int size;       //!<@brief Number of blocks of "alpha" and "beta".
+      const char*  pArgument;
+      int          block;      //!<@brief Expected block, -1 for unknown option.
+   } cases[] =
+   {
+      { 1, "--=value",  -1 },
+      { 2, "--=value",  -1 },
+      { 1, "--=",       -1 },
+      { 2, "--al",       0 },
+      { 2, "--b=value",  1 }
+   };
+   static struct VERIFY_RESULT_T result;
+   struct OPTION_BLOCK_T blockList[3];
+   struct OPTION_TABLE_T table;
+   unsigned int i;
+
+   for( i = 0; i < (sizeof( cases ) / sizeof( cases[0] )); i++ )
+   {
+      char* ppArgv[] = { "clop_bench", (char*)cases[i].pArgument, NULL };
+      struct OPTION_CONTEXT_T context =
+      {
+         .pTable     = &table,
+         .pErrorSink = &result.errorSink,
+         .pUser      = &result
+      };
+      bool passed;
+
+      memset( blockList, 0, sizeof( blockList ) );
+      blockList[0].optFunction = optRecord;
+      blockList[0].hasArg      = OPTIONAL_ARG;
+      blockList[0].longOpt     = "alpha";
+      if( cases[i].size > 1 )
+      {
+         memcpy( &blockList[1], &blockList[0], sizeof( blockList[0] ) );
+         blockList[1].longOpt = "beta";
+      }
+      if( (initOptionTable( &table, blockList ) < 0) ||
+          (enableOptionPrefixMatching( &table ) < 0) )
+      {
+         fprintf( stderr, "clop_bench: can't build the prefix table\n" );
+         return EXIT_FAILURE;
+      }
+      memset( &result, 0, sizeof( result ) );
+      result.errorSink.pErrors  = result.errors;
+      result.errorSink.capacity = VERIFY_MAX_ARGS;
+      result.ret = parseCommandLineContextAt( 1, 2, ppArgv, &context );
+      freeOptionTable( &table );
+
+      if( cases[i].block < 0 )
+         passed = (result.ret < 0) && (result.numOfRecords == 0) &&
+                  (result.errorSink.count == 1) &&
+                  (result.errors[0].code == OPT_ERR_UNKNOWN_LONG_OPTION);
+      else
+         passed = (result.ret == 2) && (result.numOfRecords == 1) &&
+                  (result.records[0].block == cases[i].block) &&
+                  (result.errorSink.count == 0);
+      if( passed )
+         continue;
+      fprintf( stderr, "clop_bench: prefix matching of \"%s\" by %u blocks "
+                       "failed, return value %d\n",
+               cases[i].pArgument, cases[i].size, result.ret );
+      return EXIT_FAILURE;
+   }
+   printf( "verify,prefix,%u cases,passed\n", i );
+   return EXIT_SUCCESS;
+}
+
+/*!============================================================================
+ */
+int main( int argc, char** ppArgv )
+{
+   struct OPTION_BLOCK_T blockList[] =
+   {
+      {
+         .optFunction = optPrintHelp,
+         .shortOpt    = 'h',
+         .longOpt     = "help",
+         .helpText    = "Print this help and exit"
+      },
+      {
+         .optFunction = optTableSizes,
+         .hasArg      = REQUIRED_ARG,
+         .shortOpt    = 't',
+         .longOpt     = "table-sizes",
+         .helpText    = "Comma separated list of the block-list sizes\n"
+                        "default: 10,100,1000,10000,100000"
+      },
+      {
+         .optFunction = optArgvLengths,
+         .hasArg      = REQUIRED_ARG,
+         .shortOpt    = 'a',
+         .longOpt     = "argv-lengths",
+         .helpText    = "Comma separated list of the numbers of arguments\n"
+                        "default: 10,100,1000"
+      },
+      {
+         .optFunction = optThreads,
+         .hasArg      = REQUIRED_ARG,
+         .shortOpt    = 'j',
+         .longOpt     = "threads",
+         .helpText    = "Comma separated list of the numbers of threads for the\n"
+                        "benchmark \"batch\", 0 means all processors\n"
+                        "default: 1,2,4,8"
+      },
+      {
+         .optFunction = optMinTime,
+         .hasArg      = REQUIRED_ARG,
+         .shortOpt    = 'm',
+         .longOpt     = "min-time",
+         .helpText    = "Minimum measuring time of each benchmark in milliseconds\n"
+                        "default: 200"
+      },
+      {
+         .optFunction = optSeed,
+         .hasArg      = REQUIRED_ARG,
+         .shortOpt    = 's',
+         .longOpt     = "seed",
+         .helpText    = "Seed of the random generator, default: 1"
+      },
+      {
+         .optFunction = optNoLinear,
+         .shortOpt    = 'n',
+         .longOpt     = "no-linear",
+         .helpText    = "Skip the engines \"linear*\", which becomes very slow by\n"
+                        "large tables and long argument vectors"
+      },
+      {
+         .optFunction = optVerify,
+         .shortOpt    = 'V',
+         .longOpt     = "verify",
+         .helpText    = "Compare the vectorized matchers of the long options with\n"
+                        "the scalar one by random block-lists and arguments\n"
+                        "and check the unique-prefix matching instead of\n"
+                        "benchmarking"
+      },
+      OPTION_BLOCKLIST_END_MARKER
+   };
+
+   struct BENCH_T bench =
+   {
+      .tableSizes  = { .number = { 10, 100, 1000, 10000, 100000 }, .count = 5 },
+      .argvLengths = { .number = { 10, 100, 1000 }, .count = 3 },
+      .threads     = { .number = { 1, 2, 4, 8 }, .count = 4 },
+      .minTimeMs   = 200,
+      .seed        = 1
+   };
+   struct SYNTHETIC_T syn;
+   unsigned int t, a, e;
+
+   if( parseCommandLineOptions( argc, ppArgv, blockList, &bench ) != argc )
+      return EXIT_FAILURE;
+
+   srand( bench.seed );
+   if( bench.verify )
+      return (verifyPrefixMatching() == EXIT_SUCCESS)? verifyMatchers() :
+                                                       EXIT_FAILURE;
+   printf( "benchmark,engine,table_size,argc,iterations,total_ns,ns_per_item\n" );
+
+   for( t = 0; t < bench.tableSizes.count; t++ )
+   {
+      memset( &syn, 0, sizeof( syn ) );
+      if( bench.tableSizes.number[t] == 0 )
+         continue;
+      makeBlockList( &syn, bench.tableSizes.number[t] );
+      if( benchPrintOptionList( &bench, &syn ) != 0 )
+         return EXIT_FAILURE;
+
+      for( a = 0; a < bench.argvLengths.count; a++ )
+      {
+         makeArgv( &syn, bench.argvLengths.number[a] );
+         for( e = 0; e < (sizeof( g_engines ) / sizeof( g_engines[0] )); e++ )
+         {
+            if( bench.noLinear && (strncmp( g_engines[e].name, "linear", 6 ) == 0) )
+               continue;
+            if( benchParse( &bench, &syn, &g_engines[e] ) != 0 )
+               return EXIT_FAILURE;
+         }
+         if( benchBatch( &bench, &syn ) != 0 )
+            return EXIT_FAILURE;
+         freeArgv( &syn );
+      }
+      free( syn.pBlockList );
+      free( syn.pNames );
+   }
+
+   return EXIT_SUCCESS;
+}
+
+/*================================== EOF ====================================*/
@@ -0,0 +1,116 @@
+/*****************************************************************************/
+/*                                                                           */
+/*!     @brief Subcommand plugin of the cold start benchmark                 */
+/*                                                                           */
+/*  A shared object with a option block-list of CLOP_PLUGIN_OPTION_COUNT     */
+/*  options, their callback functions and help texts, so the dynamic linker  */
+/*  has to relocate it like the table of a real plugin.                      */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*! @file    clop_plugin.c                                                   */
+/*! @see     parse_opts.h                                                    */
+/*! @author  Ulrich Becker                                                   */
+/*! @date    16.10.2026                                                      */
+/*****************************************************************************/
+/*
+ * MIT License
+ *
+ * Copyright (c) 2016 Ulrich Becker
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "clop_plugin.h"
+
+#ifndef CLOP_PLUGIN_INDEX
+ #error Define CLOP_PLUGIN_INDEX, e.g. -DCLOP_PLUGIN_INDEX=07
+#endif
+
+#define CLOP_PLUGIN_NAME "plugin-" CLOP_STRING( CLOP_PLUGIN_INDEX )
+
+static unsigned long g_hits;
+
+/*-----------------------------------------------------------------------------
+*/
+static int optHit( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   (void)pArg;
+   g_hits++;
+   return 0;
+}
+
+/*
+ * Option n, every third one has a argument.
+ */
+#define CLOP_PLUGIN_OPTION( n )                                             \
+   {                                                                        \
+      .optFunction = optHit,                                                \
+      .hasArg      = ((n % 3) == 2)? REQUIRED_ARG : NO_ARG,                 \
+      .id          = n,                                                     \
+      .shortOpt    = (n < 26)? 'a' + n : 0,                                 \
+      .longOpt     = "option-" #n,                                          \
+      .helpText    = "Option " #n " of " CLOP_PLUGIN_NAME ".\n"             \
+                     "Second line of the help text."                        \
+   },
+
+#define CLOP_PLUGIN_OPTION_DECADE( d )                                      \
+   CLOP_PLUGIN_OPTION( d##0 ) CLOP_PLUGIN_OPTION( d##1 )                    \
+   CLOP_PLUGIN_OPTION( d##2 ) CLOP_PLUGIN_OPTION( d##3 )                    \
+   CLOP_PLUGIN_OPTION( d##4 ) CLOP_PLUGIN_OPTION( d##5 )                    \
+   CLOP_PLUGIN_OPTION( d##6 ) CLOP_PLUGIN_OPTION( d##7 )                    \
+   CLOP_PLUGIN_OPTION( d##8 ) CLOP_PLUGIN_OPTION( d##9 )
+
+/*!
+ * @brief Number of options of each plugin.
+ */
+#define CLOP_PLUGIN_OPTION_COUNT 40
+
+struct OPTION_BLOCK_T CLOP_PLUGIN_OPTIONS( CLOP_PLUGIN_INDEX )[] =
+{
+   CLOP_PLUGIN_OPTION( 0 ) CLOP_PLUGIN_OPTION( 1 ) CLOP_PLUGIN_OPTION( 2 )
+   CLOP_PLUGIN_OPTION( 3 ) CLOP_PLUGIN_OPTION( 4 ) CLOP_PLUGIN_OPTION( 5 )
+   CLOP_PLUGIN_OPTION( 6 ) CLOP_PLUGIN_OPTION( 7 ) CLOP_PLUGIN_OPTION( 8 )
+   CLOP_PLUGIN_OPTION( 9 )
+   CLOP_PLUGIN_OPTION_DECADE( 1 )
+   CLOP_PLUGIN_OPTION_DECADE( 2 )
+   CLOP_PLUGIN_OPTION_DECADE( 3 )
+   OPTION_BLOCKLIST_END_MARKER
+};
+
+/*!----------------------------------------------------------------------------
+ * Function of the subcommand, the result shows the hits of the options.
+ */
+int CLOP_PLUGIN_FUNCTION( CLOP_PLUGIN_INDEX )( struct SUBCOMMAND_FUNCTION_ARG_T* pArg )
+{
+   (void)pArg;
+   return (g_hits > 0)? 0 : 1;
+}
+
+/*!----------------------------------------------------------------------------
+ * Subcommand object for parseSubcommandLine(), found by dlopen() and
+ * dlsym() by the name "clopBenchPlugin<index>".
+ */
+struct OPTION_SUBCOMMAND_T CLOP_PLUGIN_SUBCOMMAND( CLOP_PLUGIN_INDEX ) =
+{
+   .pOptBlockList = CLOP_PLUGIN_OPTIONS( CLOP_PLUGIN_INDEX ),
+   .function      = CLOP_PLUGIN_FUNCTION( CLOP_PLUGIN_INDEX ),
+   .helpText      = "Subcommand of " CLOP_PLUGIN_NAME
+};
+
+/*================================== EOF ====================================*/
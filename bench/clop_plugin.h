@@ -0,0 +1,76 @@
+/*****************************************************************************/
+/*                                                                           */
+/*!     @brief Common definitions of the subcommand plugin benchmark         */
+/*                                                                           */
+/*  The plugins are the same source clop_plugin.c, compiled with a different */
+/*  CLOP_PLUGIN_INDEX "00" ... "99" into the shared objects                  */
+/*  libclop_plugin_<index>.so.                                               */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*! @file    clop_plugin.h                                                   */
+/*! @see     parse_opts.h                                                    */
+/*! @author  Ulrich Becker                                                   */
+/*! @date    16.10.2026                                                      */
+/*****************************************************************************/
+/*
+ * MIT License
+ *
+ * Copyright (c) 2016 Ulrich Becker
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _CLOP_PLUGIN_H
+#define _CLOP_PLUGIN_H
+
+#include <parse_opts.h>
+
+/*!
+ * @brief Number of plugins of CLOP_FOR_EACH_PLUGIN().
+ */
+#define CLOP_NUM_OF_PLUGINS 100
+
+#define _CLOP_PASTE( a, b ) a##b
+#define CLOP_PASTE( a, b ) _CLOP_PASTE( a, b )
+#define _CLOP_STRING( a ) #a
+#define CLOP_STRING( a ) _CLOP_STRING( a )
+
+/*!
+ * @brief Exported symbols of the plugin with the index n.
+ */
+#define CLOP_PLUGIN_SUBCOMMAND( n ) CLOP_PASTE( clopBenchPlugin, n )
+#define CLOP_PLUGIN_OPTIONS( n )    CLOP_PASTE( clopBenchPluginOptions, n )
+#define CLOP_PLUGIN_FUNCTION( n )   CLOP_PASTE( clopBenchPluginFunction, n )
+
+#define _CLOP_PLUGIN_DECADE( d, X ) \
+   X( d##0 ) X( d##1 ) X( d##2 ) X( d##3 ) X( d##4 ) \
+   X( d##5 ) X( d##6 ) X( d##7 ) X( d##8 ) X( d##9 )
+
+/*!
+ * @brief Expands the macro X for each plugin index "00" ... "99".
+ */
+#define CLOP_FOR_EACH_PLUGIN( X )                                           \
+   _CLOP_PLUGIN_DECADE( 0, X ) _CLOP_PLUGIN_DECADE( 1, X )                 \
+   _CLOP_PLUGIN_DECADE( 2, X ) _CLOP_PLUGIN_DECADE( 3, X )                 \
+   _CLOP_PLUGIN_DECADE( 4, X ) _CLOP_PLUGIN_DECADE( 5, X )                 \
+   _CLOP_PLUGIN_DECADE( 6, X ) _CLOP_PLUGIN_DECADE( 7, X )                 \
+   _CLOP_PLUGIN_DECADE( 8, X ) _CLOP_PLUGIN_DECADE( 9, X )
+
+#endif /* ifndef _CLOP_PLUGIN_H */
+/*================================== EOF ====================================*/
@@ -0,0 +1,217 @@
+/*****************************************************************************/
+/*                                                                           */
+/*!     @brief Cold start benchmark of subcommand plugins                    */
+/*                                                                           */
+/*  Starts the host clop_plugin_eager, linked against all plugins, and the   */
+/*  host clop_plugin_lazy, which loads the invoked plugin by dlopen(), again */
+/*  and again with the same subcommand and measures the time from the        */
+/*  spawn to the exit. The results becomes written as CSV in stdout.         */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*! @file    clop_plugin_bench.c                                             */
+/*! @see     parse_opts.h                                                    */
+/*! @author  Ulrich Becker                                                   */
+/*! @date    16.10.2026                                                      */
+/*****************************************************************************/
+/*
+ * MIT License
+ *
+ * Copyright (c) 2016 Ulrich Becker
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "clop_plugin.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <spawn.h>
+#include <sys/wait.h>
+
+extern char** environ;
+
+#ifndef CLOP_PLUGIN_EAGER_HOST
+ #define CLOP_PLUGIN_EAGER_HOST "./clop_plugin_eager"
+#endif
+#ifndef CLOP_PLUGIN_LAZY_HOST
+ #define CLOP_PLUGIN_LAZY_HOST "./clop_plugin_lazy"
+#endif
+
+struct BENCH_T
+{
+   const char*  eagerHost;
+   const char*  lazyHost;
+   unsigned int minTimeMs;
+};
+
+/*-----------------------------------------------------------------------------
+*/
+static inline uint64_t nanoTime( void )
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+   return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optEagerHost( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   ((struct BENCH_T*)pArg->pUser)->eagerHost = pArg->optArg;
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optLazyHost( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   ((struct BENCH_T*)pArg->pUser)->lazyHost = pArg->optArg;
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optMinTime( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   ((struct BENCH_T*)pArg->pUser)->minTimeMs = (unsigned int)atoi( pArg->optArg );
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optPrintHelp( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   printf( "Cold start benchmark of %u subcommand plugins.\n\n"
+           "Usage: %s [options]\nOptions:\n", CLOP_NUM_OF_PLUGINS, pArg->ppAgv[0] );
+   printOptionList( stdout, pArg->pOptBlockList );
+   printf( "Output: CSV in stdout with the columns\n"
+           "benchmark,engine,table_size,argc,iterations,total_ns,ns_per_item\n"
+           "table_size is the number of plugins, the items of ns_per_item are\n"
+           "the starts of the host.\n" );
+   exit( EXIT_SUCCESS );
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ * Starts the host with a subcommand of the middle plugin until the minimum
+ * time has been expired.
+ */
+static int benchColdStart( struct BENCH_T* pBench, const char* engine,
+                           const char* host )
+{
+   char* ppArgv[] =
+   {
+      (char*)host, "plugin-42", "--option-7", "-c", "value", "--option-38", "x",
+      NULL
+   };
+   const int argc = (sizeof( ppArgv ) / sizeof( ppArgv[0] )) - 1;
+   const uint64_t minNs = (uint64_t)pBench->minTimeMs * 1000000ULL;
+   unsigned long iterations = 0;
+   uint64_t start, now;
+   pid_t pid;
+   int status;
+
+   start = nanoTime();
+   do
+   {
+      status = posix_spawn( &pid, host, NULL, NULL, ppArgv, environ );
+      if( status != 0 )
+      {
+         fprintf( stderr, "clop_plugin_bench: can't start %s: %s\n",
+                  host, strerror( status ) );
+         return -1;
+      }
+      if( (waitpid( pid, &status, 0 ) != pid) || !WIFEXITED( status ) ||
+          (WEXITSTATUS( status ) != EXIT_SUCCESS) )
+      {
+         fprintf( stderr, "clop_plugin_bench: %s has been failed\n", host );
+         return -1;
+      }
+      iterations++;
+      now = nanoTime();
+   }
+   while( (now - start) < minNs );
+
+   printf( "cold_start,%s,%u,%d,%lu,%llu,%.2f\n",
+           engine, CLOP_NUM_OF_PLUGINS, argc, iterations,
+           (unsigned long long)(now - start),
+           (double)(now - start) / (double)iterations );
+   fflush( stdout );
+   return 0;
+}
+
+/*!============================================================================
+ */
+int main( int argc, char** ppArgv )
+{
+   struct OPTION_BLOCK_T blockList[] =
+   {
+      {
+         .optFunction = optPrintHelp,
+         .shortOpt    = 'h',
+         .longOpt     = "help",
+         .helpText    = "Print this help and exit"
+      },
+      {
+         .optFunction = optEagerHost,
+         .hasArg      = REQUIRED_ARG,
+         .shortOpt    = 'e',
+         .longOpt     = "eager",
+         .helpText    = "Path of the host linked against all plugins\n"
+                        "default: " CLOP_PLUGIN_EAGER_HOST
+      },
+      {
+         .optFunction = optLazyHost,
+         .hasArg      = REQUIRED_ARG,
+         .shortOpt    = 'l',
+         .longOpt     = "lazy",
+         .helpText    = "Path of the host loading the plugins by dlopen()\n"
+                        "default: " CLOP_PLUGIN_LAZY_HOST
+      },
+      {
+         .optFunction = optMinTime,
+         .hasArg      = REQUIRED_ARG,
+         .shortOpt    = 'm',
+         .longOpt     = "min-time",
+         .helpText    = "Minimum measuring time of each host in milliseconds,\n"
+                        "default: 1000"
+      },
+      OPTION_BLOCKLIST_END_MARKER
+   };
+
+   struct BENCH_T bench =
+   {
+      .eagerHost = CLOP_PLUGIN_EAGER_HOST,
+      .lazyHost  = CLOP_PLUGIN_LAZY_HOST,
+      .minTimeMs = 1000
+   };
+
+   if( parseCommandLineOptions( argc, ppArgv, blockList, &bench ) != argc )
+      return EXIT_FAILURE;
+
+   printf( "benchmark,engine,table_size,argc,iterations,total_ns,ns_per_item\n" );
+   if( benchColdStart( &bench, "eager", bench.eagerHost ) != 0 )
+      return EXIT_FAILURE;
+   if( benchColdStart( &bench, "lazy", bench.lazyHost ) != 0 )
+      return EXIT_FAILURE;
+   return EXIT_SUCCESS;
+}
+
+/*================================== EOF ====================================*/
@@ -0,0 +1,87 @@
+/*****************************************************************************/
+/*                                                                           */
+/*!     @brief Host of the subcommand plugin benchmark                       */
+/*                                                                           */
+/*  Compiled twice: with CLOP_PLUGIN_EAGER the executable is linked against  */
+/*  all plugins, so the dynamic linker loads and relocates all of them by    */
+/*  the start. Without it the subcommands are placeholders and only the      */
+/*  invoked plugin becomes loaded by parseSubcommandLine() from              */
+/*  CLOP_PLUGIN_DIR.                                                         */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*! @file    clop_plugin_host.c                                              */
+/*! @see     parse_opts.h                                                    */
+/*! @author  Ulrich Becker                                                   */
+/*! @date    16.10.2026                                                      */
+/*****************************************************************************/
+/*
+ * MIT License
+ *
+ * Copyright (c) 2016 Ulrich Becker
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "clop_plugin.h"
+#include <stdlib.h>
+
+#ifdef CLOP_PLUGIN_EAGER
+ #define CLOP_DECLARE_PLUGIN( n )                                           \
+   extern struct OPTION_BLOCK_T CLOP_PLUGIN_OPTIONS( n )[];                 \
+   int CLOP_PLUGIN_FUNCTION( n )( struct SUBCOMMAND_FUNCTION_ARG_T* pArg );
+CLOP_FOR_EACH_PLUGIN( CLOP_DECLARE_PLUGIN )
+
+ #define CLOP_PLUGIN_ENTRY( n )                                             \
+   {                                                                        \
+      .name          = "plugin-" #n,                                        \
+      .pOptBlockList = CLOP_PLUGIN_OPTIONS( n ),                            \
+      .function      = CLOP_PLUGIN_FUNCTION( n )                            \
+   },
+#else
+ #ifndef CLOP_PLUGIN_DIR
+  #define CLOP_PLUGIN_DIR "."
+ #endif
+ #define CLOP_PLUGIN_ENTRY( n )                                             \
+   {                                                                        \
+      .name         = "plugin-" #n,                                         \
+      .pluginPath   = CLOP_PLUGIN_DIR "/libclop_plugin_" #n ".so",          \
+      .pluginSymbol = "clopBenchPlugin" #n                                  \
+   },
+#endif
+
+static struct OPTION_SUBCOMMAND_T g_plugins[] =
+{
+   CLOP_FOR_EACH_PLUGIN( CLOP_PLUGIN_ENTRY )
+   OPTION_SUBCOMMAND_END_MARKER
+};
+
+/*!============================================================================
+ * Usage: clop_plugin_eager|clop_plugin_lazy plugin-<index> [options]
+ */
+int main( int argc, char** ppArgv )
+{
+   struct OPTION_SUBCOMMAND_T root = { .pSubcommands = g_plugins };
+   int ret;
+
+   ret = parseSubcommandLine( argc, ppArgv, &root, NULL );
+   freeSubcommandTables( &root );
+   return (ret == 0)? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*================================== EOF ====================================*/
@@ -0,0 +1,38 @@
+###############################################################################
+##                                                                           ##
+##   Shell completion scripts of a program which answers the completion      ##
+##   requests by completeCommandLine(): "clop_add_completion(<target>)"      ##
+##                                                                           ##
+##---------------------------------------------------------------------------##
+## Generates the bash script <program> and the zsh script _<program> in      ##
+## <build dir>/completion from the templates clop_completion.*.in and        ##
+## installs them in the directories of bash-completion and zsh.              ##
+###############################################################################
+
+include(GNUInstallDirs)
+
+# Templates in the source tree respectively beside the installed module.
+if(EXISTS ${CMAKE_CURRENT_LIST_DIR}/completion)
+    set(_CLOP_COMPLETION_TEMPLATES ${CMAKE_CURRENT_LIST_DIR}/completion)
+else()
+    set(_CLOP_COMPLETION_TEMPLATES ${CMAKE_CURRENT_LIST_DIR}/../completion)
+endif()
+
+function(clop_add_completion target)
+    get_target_property(CLOP_PROGRAM ${target} OUTPUT_NAME)
+    if(NOT CLOP_PROGRAM)
+        set(CLOP_PROGRAM ${target})
+    endif()
+    string(MAKE_C_IDENTIFIER ${CLOP_PROGRAM} CLOP_FUNCTION)
+
+    set(_clop_dir ${CMAKE_CURRENT_BINARY_DIR}/completion)
+    configure_file(${_CLOP_COMPLETION_TEMPLATES}/clop_completion.bash.in
+                   ${_clop_dir}/${CLOP_PROGRAM} @ONLY)
+    configure_file(${_CLOP_COMPLETION_TEMPLATES}/clop_completion.zsh.in
+                   ${_clop_dir}/_${CLOP_PROGRAM} @ONLY)
+
+    install(FILES ${_clop_dir}/${CLOP_PROGRAM}
+        DESTINATION ${CMAKE_INSTALL_DATADIR}/bash-completion/completions)
+    install(FILES ${_clop_dir}/_${CLOP_PROGRAM}
+        DESTINATION ${CMAKE_INSTALL_DATADIR}/zsh/site-functions)
+endfunction()
@@ -0,0 +1,104 @@
+###############################################################################
+##                                                                           ##
+##   Footprint of parse_opts.c in each combination of the CONFIG_CLOP_*      ##
+##   switches: "cmake --build <dir> --target clop_footprint"                 ##
+##                                                                           ##
+##---------------------------------------------------------------------------##
+## Each configuration becomes compiled with -Os into an own object file,     ##
+## so the build tool can compile them in parallel and incremental.           ##
+## footprint_report.cmake measures the sections .text and .rodata* by the    ##
+## tool "size" and writes the table clop_footprint.csv in the build dir.     ##
+## With CLOP_FOOTPRINT_BASELINE=<csv file of a previous run> the target      ##
+## fails when a configuration has become larger than in the baseline.        ##
+###############################################################################
+
+set(CLOP_FOOTPRINT_BASELINE "" CACHE FILEPATH
+    "CSV file of a previous clop_footprint run, larger configurations are failing")
+set(CLOP_FOOTPRINT_TOLERANCE 0 CACHE STRING
+    "Number of bytes a section may grow against CLOP_FOOTPRINT_BASELINE")
+set(CLOP_FOOTPRINT_FLAGS "-Os" CACHE STRING
+    "Compiler flags of the footprint measurement, e.g. -Os -mthumb -mcpu=cortex-m4")
+
+# The size tool of the toolchain, e.g. arm-poky-linux-gnueabi-size by yocto.
+if(CMAKE_NM)
+    string(REGEX REPLACE "nm$" "size" _clop_size_guess "${CMAKE_NM}")
+endif()
+find_program(CLOP_SIZE_TOOL NAMES ${_clop_size_guess} size)
+
+if(NOT CLOP_SIZE_TOOL OR NOT CMAKE_C_COMPILER_ID MATCHES "GNU|Clang")
+    message(STATUS "clop_footprint: needs a GNU compatible compiler and \"size\", target omitted")
+    return()
+endif()
+
+# Each bit of the mask is one switch, the argument kinds are the lowest bits.
+set(_clop_switches
+    NO_NO_ARG NO_REQUIRED_ARG NO_OPTIONAL_ARG
+    NO_TYPED_VALUES NO_ESC_SEQUENCES
+    NO_STDIO NO_STREAM NO_RESPONSE_FILES NO_THREADS NO_DLOPEN NO_SIMD
+)
+# CONFIG_CLOP_FREESTANDING implies the last six switches.
+set(_clop_freestanding_switches 6)
+
+set(_clop_dir ${CMAKE_CURRENT_BINARY_DIR}/clop_footprint)
+set(_clop_manifest ${_clop_dir}/manifest.txt)
+set(_clop_objects)
+file(MAKE_DIRECTORY ${_clop_dir})
+file(WRITE ${_clop_manifest} "")
+separate_arguments(_clop_flags NATIVE_COMMAND "${CLOP_FOOTPRINT_FLAGS}")
+
+foreach(_clop_profile hosted freestanding)
+    if(_clop_profile STREQUAL "freestanding")
+        set(_clop_defines -DCONFIG_CLOP_FREESTANDING)
+        set(_clop_num_switches ${_clop_freestanding_switches})
+    else()
+        set(_clop_defines)
+        list(LENGTH _clop_switches _clop_num_switches)
+    endif()
+    math(EXPR _clop_last_mask "(1 << ${_clop_num_switches}) - 1")
+
+    foreach(_clop_mask RANGE 0 ${_clop_last_mask})
+        # All three argument kinds disabled is not allowed.
+        math(EXPR _clop_arg_kinds "${_clop_mask} & 7")
+        if(_clop_arg_kinds EQUAL 7)
+            continue()
+        endif()
+
+        set(_clop_name ${_clop_profile})
+        set(_clop_config_defines ${_clop_defines})
+        set(_clop_bit 0)
+        foreach(_clop_switch IN LISTS _clop_switches)
+            math(EXPR _clop_set "(${_clop_mask} >> ${_clop_bit}) & 1")
+            if(_clop_set)
+                string(APPEND _clop_name "+${_clop_switch}")
+                list(APPEND _clop_config_defines -DCONFIG_CLOP_${_clop_switch})
+            endif()
+            math(EXPR _clop_bit "${_clop_bit} + 1")
+        endforeach()
+
+        set(_clop_object ${_clop_dir}/${_clop_profile}_${_clop_mask}.o)
+        add_custom_command(OUTPUT ${_clop_object}
+            COMMAND ${CMAKE_C_COMPILER} ${_clop_flags} ${_clop_config_defines}
+                    -I${CMAKE_CURRENT_SOURCE_DIR}/src
+                    -c ${CMAKE_CURRENT_SOURCE_DIR}/src/parse_opts.c
+                    -o ${_clop_object}
+            DEPENDS ${CMAKE_CURRENT_SOURCE_DIR}/src/parse_opts.c
+                    ${CMAKE_CURRENT_SOURCE_DIR}/src/parse_opts.h
+            VERBATIM
+        )
+        list(APPEND _clop_objects ${_clop_object})
+        file(APPEND ${_clop_manifest} "${_clop_name};${_clop_object}\n")
+    endforeach()
+endforeach()
+
+add_custom_target(clop_footprint
+    COMMAND ${CMAKE_COMMAND}
+            -DMANIFEST=${_clop_manifest}
+            -DSIZE_TOOL=${CLOP_SIZE_TOOL}
+            -DOUTPUT=${CMAKE_CURRENT_BINARY_DIR}/clop_footprint.csv
+            -DBASELINE=${CLOP_FOOTPRINT_BASELINE}
+            -DTOLERANCE=${CLOP_FOOTPRINT_TOLERANCE}
+            -P ${CMAKE_CURRENT_SOURCE_DIR}/cmake/footprint_report.cmake
+    DEPENDS ${_clop_objects}
+    COMMENT "Measuring the footprint of the CONFIG_CLOP_* configurations"
+    VERBATIM
+)
@@ -0,0 +1,55 @@
+###############################################################################
+##                                                                           ##
+##   Cold start benchmark of subcommand plugins:                             ##
+##   "cmake --build <dir> --target clop_plugin_bench"                        ##
+##                                                                           ##
+##---------------------------------------------------------------------------##
+## bench/clop_plugin.c becomes built as 100 shared objects. The host         ##
+## clop_plugin_eager is linked against all of them, the host                ##
+## clop_plugin_lazy loads only the invoked one by dlopen(). The targets are  ##
+## not part of "all".                                                        ##
+###############################################################################
+
+if(NOT UNIX)
+    message(STATUS "clop_plugin_bench: needs dlopen(), target omitted")
+    return()
+endif()
+
+set(_clop_plugin_dir ${CMAKE_CURRENT_BINARY_DIR}/clop_plugins)
+set(_clop_plugins)
+
+foreach(_clop_index RANGE 0 99)
+    if(_clop_index LESS 10)
+        set(_clop_index 0${_clop_index})
+    endif()
+    add_library(clop_plugin_${_clop_index} SHARED EXCLUDE_FROM_ALL
+        ${CMAKE_CURRENT_SOURCE_DIR}/bench/clop_plugin.c)
+    target_compile_definitions(clop_plugin_${_clop_index} PRIVATE
+        CLOP_PLUGIN_INDEX=${_clop_index})
+    target_include_directories(clop_plugin_${_clop_index} PRIVATE
+        ${CMAKE_CURRENT_SOURCE_DIR}/src)
+    set_target_properties(clop_plugin_${_clop_index} PROPERTIES
+        LIBRARY_OUTPUT_DIRECTORY ${_clop_plugin_dir})
+    list(APPEND _clop_plugins clop_plugin_${_clop_index})
+endforeach()
+
+add_executable(clop_plugin_eager EXCLUDE_FROM_ALL
+    ${CMAKE_CURRENT_SOURCE_DIR}/bench/clop_plugin_host.c)
+target_compile_definitions(clop_plugin_eager PRIVATE CLOP_PLUGIN_EAGER)
+target_link_libraries(clop_plugin_eager PRIVATE
+    command_line_option_parser ${_clop_plugins})
+
+add_executable(clop_plugin_lazy EXCLUDE_FROM_ALL
+    ${CMAKE_CURRENT_SOURCE_DIR}/bench/clop_plugin_host.c)
+target_compile_definitions(clop_plugin_lazy PRIVATE
+    CLOP_PLUGIN_DIR="${_clop_plugin_dir}")
+target_link_libraries(clop_plugin_lazy PRIVATE command_line_option_parser)
+add_dependencies(clop_plugin_lazy ${_clop_plugins})
+
+add_executable(clop_plugin_bench EXCLUDE_FROM_ALL
+    ${CMAKE_CURRENT_SOURCE_DIR}/bench/clop_plugin_bench.c)
+target_compile_definitions(clop_plugin_bench PRIVATE
+    CLOP_PLUGIN_EAGER_HOST="$<TARGET_FILE:clop_plugin_eager>"
+    CLOP_PLUGIN_LAZY_HOST="$<TARGET_FILE:clop_plugin_lazy>")
+target_link_libraries(clop_plugin_bench PRIVATE command_line_option_parser)
+add_dependencies(clop_plugin_bench clop_plugin_eager clop_plugin_lazy)
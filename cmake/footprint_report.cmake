@@ -0,0 +1,83 @@
+###############################################################################
+##                                                                           ##
+##   Report of the target clop_footprint, invoked by "cmake -P"              ##
+##                                                                           ##
+##---------------------------------------------------------------------------##
+## MANIFEST:  File with lines "<configuration>;<object file>"                ##
+## SIZE_TOOL: The tool "size" of the toolchain                               ##
+## OUTPUT:    CSV file to write: configuration,text,rodata                   ##
+## BASELINE:  Optional CSV file of a previous run                            ##
+## TOLERANCE: Bytes a section may grow against the baseline                  ##
+###############################################################################
+
+if(NOT TOLERANCE)
+    set(TOLERANCE 0)
+endif()
+
+if(BASELINE)
+    file(STRINGS ${BASELINE} _baseline_lines)
+    foreach(_line IN LISTS _baseline_lines)
+        string(REPLACE "," ";" _fields "${_line}")
+        list(GET _fields 0 _name)
+        list(GET _fields 1 _text)
+        list(GET _fields 2 _rodata)
+        set(_base_text_${_name} ${_text})
+        set(_base_rodata_${_name} ${_rodata})
+    endforeach()
+endif()
+
+file(STRINGS ${MANIFEST} _configurations)
+set(_csv "configuration,text,rodata\n")
+set(_regressions 0)
+message("     .text   .rodata  configuration")
+
+foreach(_configuration IN LISTS _configurations)
+    list(GET _configuration 0 _name)
+    list(GET _configuration 1 _object)
+
+    execute_process(COMMAND ${SIZE_TOOL} -A ${_object}
+        OUTPUT_VARIABLE _sections
+        RESULT_VARIABLE _result
+    )
+    if(NOT _result EQUAL 0)
+        message(FATAL_ERROR "${SIZE_TOOL} failed on ${_object}")
+    endif()
+
+    # Lines: "<section> <size> <address>", all .rodata* sections are summed.
+    set(_text 0)
+    set(_rodata 0)
+    string(REPLACE "\n" ";" _sections "${_sections}")
+    foreach(_section IN LISTS _sections)
+        if(_section MATCHES "^\\.text[^ ]* +([0-9]+)")
+            math(EXPR _text "${_text} + ${CMAKE_MATCH_1}")
+        elseif(_section MATCHES "^\\.rodata[^ ]* +([0-9]+)")
+            math(EXPR _rodata "${_rodata} + ${CMAKE_MATCH_1}")
+        endif()
+    endforeach()
+
+    string(APPEND _csv "${_name},${_text},${_rodata}\n")
+    string(LENGTH "${_text}" _l1)
+    string(LENGTH "${_rodata}" _l2)
+    math(EXPR _l1 "10 - ${_l1}")
+    math(EXPR _l2 "10 - ${_l2}")
+    string(REPEAT " " ${_l1} _pad1)
+    string(REPEAT " " ${_l2} _pad2)
+    message("${_pad1}${_text}${_pad2}${_rodata}  ${_name}")
+
+    if(DEFINED _base_text_${_name})
+        math(EXPR _max_text "${_base_text_${_name}} + ${TOLERANCE}")
+        math(EXPR _max_rodata "${_base_rodata_${_name}} + ${TOLERANCE}")
+        if(_text GREATER _max_text OR _rodata GREATER _max_rodata)
+            message("  ^ grown against baseline: .text ${_base_text_${_name}}, "
+                    ".rodata ${_base_rodata_${_name}}")
+            math(EXPR _regressions "${_regressions} + 1")
+        endif()
+    endif()
+endforeach()
+
+file(WRITE ${OUTPUT} "${_csv}")
+message("Written: ${OUTPUT}")
+
+if(_regressions GREATER 0)
+    message(FATAL_ERROR "${_regressions} configuration(s) larger than in ${BASELINE}")
+endif()
@@ -0,0 +1,132 @@
+/*****************************************************************************/
+/*                                                                           */
+/*        Example program for using the command line option parser           */
+/*                                                                           */
+/*     Demonstration of a compile-time option table in C++17 with real      */
+/*     C++ lambdas as option functions.                                      */
+/*     Handling of mixed order of option and non-option arguments.           */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*! @file    cmd_opt_ex4.cpp                                                 */
+/*! @author  Ulrich Becker                                                   */
+/*! @date    16.10.2026                                                      */
+/*! @see     parse_opts.hpp                                                  */
+/*****************************************************************************/
+
+/*
+ * NOTE:
+ * If you have been made and installed the shared-library via the makefile in
+ * /src/makefile just compile this example by the following line:
+ *
+ * g++ -std=c++17 -o e4 cmd_opt_ex4.cpp -lParseOptsC
+ *
+ * otherwise invoke the makefile in this directory.
+ */
+
+#include <parse_opts.hpp>
+#include <cstdio>
+#include <cstdlib>
+
+/*!----------------------------------------------------------------------------
+ * @brief The program variables which shall be modified by the options in our
+ *        Example.
+ */
+struct MY_DATA
+{
+   const char* logfileName;
+   unsigned int flags;
+   int integer;
+};
+
+/*!----------------------------------------------------------------------------
+ * @brief Shared function for more then one options.
+ */
+static void setFlag( BLOCK_FUNCTION_ARG_T& rArg, unsigned int flag )
+{
+   static_cast<MY_DATA*>( rArg.pUser )->flags |= (1 << flag);
+}
+
+/*!----------------------------------------------------------------------------
+ * @brief The option table of our example.
+ *
+ * Hash index and short option dispatch becomes computed by the compiler,
+ * a duplicate option name would be a compile error.
+ */
+static constexpr auto g_options = clop::makeTable(
+   clop::makeOption( 'h', "help", NO_ARG, "Print this help and exit",
+      []( BLOCK_FUNCTION_ARG_T& rArg )
+      {
+         printf( "Usage: %s [options] [argunents]\nOptions:\n", rArg.ppAgv[0] );
+         printOptionList( stdout, rArg.pOptBlockList );
+         exit( EXIT_SUCCESS );
+      }),
+   clop::makeOption( 'l', "logfile", OPTIONAL_ARG,
+                     "Logfile. If set logging is enabled.\n"
+                     "You can name a explicit logfile in PARAM",
+      []( BLOCK_FUNCTION_ARG_T& rArg )
+      {
+         if( rArg.optArg == nullptr ) // No argument given?
+            static_cast<MY_DATA*>( rArg.pUser )->logfileName = "/var/log/myDefaultLogfile";
+         else
+            static_cast<MY_DATA*>( rArg.pUser )->logfileName = rArg.optArg;
+      }),
+   clop::makeOption( 'a', nullptr, NO_ARG, "Set flag 'a'",
+      []( BLOCK_FUNCTION_ARG_T& rArg ) { setFlag( rArg, 0 ); }),
+   clop::makeOption( 'b', nullptr, NO_ARG, "Set flag 'b'",
+      []( BLOCK_FUNCTION_ARG_T& rArg ) { setFlag( rArg, 1 ); }),
+   clop::makeOption( 'c', nullptr, NO_ARG, "Set flag 'c'",
+      []( BLOCK_FUNCTION_ARG_T& rArg ) { setFlag( rArg, 2 ); }),
+   clop::makeOption( 'i', "integer", REQUIRED_ARG, "Read a integer number in PARAM",
+      []( BLOCK_FUNCTION_ARG_T& rArg )
+      {
+         char* pEnd;
+
+         static_cast<MY_DATA*>( rArg.pUser )->integer = strtol( rArg.optArg, &pEnd, 10 );
+         if( (*pEnd == '\0') && (pEnd != rArg.optArg) )
+            return 0;
+
+         fprintf( stderr, "%s: Argument no: %d invalid format of integer number \"%s\" for option: \"",
+                  rArg.ppAgv[0], rArg.argvIndex, rArg.optArg );
+         printOption( stderr, rArg.pCurrentBlock );
+         fprintf( stderr, "\"\n" );
+         return -1;
+      })
+).withUniquePrefixes();
+
+/*!============================================================================
+ * @brief The main function of our example.
+ */
+int main( int argc, char** ppArgv )
+{
+   MY_DATA myData = { nullptr, 0, 0 };
+   int i;
+
+   printf( "\n" );
+   /*
+    * Parsing-loop of the whole commend line.
+    */
+   for( i = 1; i < argc; i++ )
+   {
+      i = clop::COMPILED_T<g_options>::parse( i, argc, ppArgv, &myData );
+      if( i < 0 )
+         return EXIT_FAILURE;
+      if( i < argc )
+         printf( "Non option argument in ppArgv[%d]: \"%s\"\n", i, ppArgv[i] );
+   }
+
+   if( myData.logfileName != nullptr )
+      printf( "Logfile will used: %s\n", myData.logfileName );
+   else
+      printf( "No logfile will used\n" );
+
+   printf( "Flags:\n" );
+   for( i = 0; i < 3; i++ )
+      printf( "Flag %c is %s\n",
+              'a' + i,
+              ((myData.flags & (1 << i)) != 0)? "set" : "not set" );
+
+   printf( "Integer value = %d\n\n", myData.integer );
+
+   return EXIT_SUCCESS;
+}
+/*================================== EOF ====================================*/
@@ -33,11 +33,55 @@
  * SOFTWARE.
  */
 
+/*
+ * Needed by clock_gettime( CLOCK_MONOTONIC ) and mmap( MAP_ANONYMOUS )
+ * in strict ISO C mode.
+ */
+#ifndef _POSIX_C_SOURCE
+ #define _POSIX_C_SOURCE 200809L
+#endif
+#ifndef _DEFAULT_SOURCE
+ #define _DEFAULT_SOURCE
+#endif
+
 #include <parse_opts.h>
-#include <string.h>
 #include <stdbool.h>
-#include <stdlib.h>
-#include <assert.h>
+#include <stdint.h>
+#ifndef CONFIG_CLOP_FREESTANDING
+ #include <string.h>
+ #include <stdlib.h>
+ #include <assert.h>
+#endif
+#ifndef CONFIG_CLOP_NO_RESPONSE_FILES
+ #include <sys/mman.h>
+ #include <sys/stat.h>
+ #include <fcntl.h>
+#endif
+#if !defined( CONFIG_CLOP_NO_RESPONSE_FILES ) || !defined( CONFIG_CLOP_NO_STREAM ) \
+    || !defined( CONFIG_CLOP_NO_THREADS )
+ #include <unistd.h>
+ #include <errno.h>
+#endif
+#ifndef CONFIG_CLOP_NO_TYPED_VALUES
+ #include <float.h>
+#endif
+#ifndef CONFIG_CLOP_NO_THREADS
+ #include <pthread.h>
+ #include <stdatomic.h>
+#endif
+#ifndef CONFIG_CLOP_NO_DLOPEN
+ #include <dlfcn.h>
+#endif
+#if !defined( CONFIG_CLOP_NO_SIMD ) && defined( __GNUC__ ) \
+    && (defined( __x86_64__ ) || defined( __i386__ ))
+ #include <immintrin.h>
+ #define HAVE_X86_SIMD
+#endif
+#if !defined( CONFIG_CLOP_NO_STDIO ) \
+    || (defined( CONFIG_CLOP_STATISTICS ) && !defined( CONFIG_CLOP_FREESTANDING ))
+ #include <time.h>
+ #define HAVE_MONOTONIC_CLOCK
+#endif
 
 #if defined( CONFIG_CLOP_NO_NO_ARG )          \
     && defined( CONFIG_CLOP_NO_REQUIRED_ARG ) \
@@ -49,6 +93,8 @@
 #define ESC_BOLD   "\e[1m"
 #define ESC_NORMAL "\e[0m"
 
+#define IS_SPACE( c ) (((c) == ' ') || (((c) >= '\t') && ((c) <= '\r')))
+
 #ifdef CONFIG_CLOP_NO_ESC_SEQUENCES
   #define ESC_ERROR
   #define ESC_END
@@ -57,379 +103,4567 @@
   #define ESC_END   ESC_NORMAL
 #endif
 
-#ifndef CONFIG_CLOP_NO_OPTIONAL_ARG
+#ifdef CONFIG_CLOP_FREESTANDING
+/*
+ * Own implementations of the few used string functions, so the library
+ * doesn't need any function of libc. The compiler may nevertheless emit
+ * calls of memcpy() and memset() for copies of structures, they are part
+ * of each freestanding runtime library anyway.
+ */
+#define assert( condition ) ((void)0)
+
 /*-----------------------------------------------------------------------------
 */
-static void longOptionalOptionErrorMessage( const char* prgName,
-                                            const char* optionName )
+static size_t clopStrlen( const char* str )
 {
-   fprintf( stderr, ESC_ERROR
-                    "%s: missing argument after '=' of long option --%s\n"
-                    ESC_END,
-            prgName, optionName );
+   const char* pC = str;
+
+   while( *pC != '\0' )
+      pC++;
+   return pC - str;
 }
 
 /*-----------------------------------------------------------------------------
 */
-static void shortOptionalOptionErrorMessage( const char* prgName,
-                                             char optionName )
+static int clopStrncmp( const char* str1, const char* str2, size_t n )
 {
-   fprintf( stderr, ESC_ERROR
-                    "%s: missing argument after '=' of short option -%c\n"
-                    ESC_END,
-            prgName, optionName );
+   for( ; n > 0; n--, str1++, str2++ )
+   {
+      if( *str1 != *str2 )
+         return (unsigned char)*str1 - (unsigned char)*str2;
+      if( *str1 == '\0' )
+         break;
+   }
+   return 0;
 }
-#endif /* ifndef CONFIG_CLOP_NO_OPTIONAL_ARG */
 
-/*!----------------------------------------------------------------------------
-@see parse_opts.h
+/*-----------------------------------------------------------------------------
 */
+static inline int clopStrcmp( const char* str1, const char* str2 )
+{
+   return clopStrncmp( str1, str2, (size_t)-1 );
+}
 
-#define _RETURN_HANDLING( f ) \
-   ret = (f);                 \
-   if( ret < 0 )              \
-      return ret;             \
-   if( ret > 0 )              \
-      error = true;           \
-
-int parseCommandLineOptionsAt( int offset,
-                               int argc,
-                               char* const ppAgv[],
-                               struct OPTION_BLOCK_T optBlockList[],
-                               void* pUser
-                             )
+/*-----------------------------------------------------------------------------
+*/
+static int clopMemcmp( const void* p1, const void* p2, size_t n )
 {
-   struct BLOCK_FUNCTION_ARG_T arg =
+   const unsigned char* pC1 = p1;
+   const unsigned char* pC2 = p2;
+
+   for( ; n > 0; n--, pC1++, pC2++ )
    {
-      .argc          = argc,
-      .ppAgv         = ppAgv,
-      .pOptBlockList = optBlockList,
-      .pUser         = pUser
-   };
+      if( *pC1 != *pC2 )
+         return *pC1 - *pC2;
+   }
+   return 0;
+}
 
-   bool error = false;
-   int ret;
-   size_t tl;
-   char* pCurrent;
+/*-----------------------------------------------------------------------------
+*/
+static void* clopMemcpy( void* pDest, const void* pSrc, size_t n )
+{
+   unsigned char* pD = pDest;
+   const unsigned char* pS = pSrc;
+
+   while( n-- > 0 )
+      *pD++ = *pS++;
+   return pDest;
+}
 
-   for( arg.argvIndex = offset; arg.argvIndex < argc; arg.argvIndex++ )
+/*-----------------------------------------------------------------------------
+*/
+static char* clopStrchr( const char* str, int c )
+{
+   for( ; *str != (char)c; str++ )
    {
-      if( ppAgv[arg.argvIndex][0] != '-' )
-         break; /* No (further) option present. */
+      if( *str == '\0' )
+         return NULL;
+   }
+   return (char*)str;
+}
 
-      pCurrent = &ppAgv[arg.argvIndex][1];
-      if( *pCurrent == '\0' )
-      {
-         fprintf( stderr, ESC_ERROR "%s: missing option -?\n" ESC_END, ppAgv[0] );
-         return -1;
-      }
+#define strlen  clopStrlen
+#define strncmp clopStrncmp
+#define strcmp  clopStrcmp
+#define memcmp  clopMemcmp
+#define memcpy  clopMemcpy
+#define strchr  clopStrchr
+#endif /* ifdef CONFIG_CLOP_FREESTANDING */
 
-#ifndef CONFIG_NO_NEGATIVE_NUMBERS_IN_NON_OPTION_ARGUMENTS
-      /* In the case the first non-option argument is a negative number. */
-      if( (*pCurrent >= '0') && (*pCurrent <= '9') )
-         break; /* Argument is not a option but a negative number. */
-#endif
+static void reportError( struct OPTION_ERROR_SINK_T* pSink, const char* prgName,
+                         const struct OPTION_ERROR_T* pError );
 
-      arg.optArg = NULL;
+#ifdef HAVE_MONOTONIC_CLOCK
+/*-----------------------------------------------------------------------------
+*/
+static inline uint64_t monotonicNanoseconds( void )
+{
+   struct timespec ts;
 
-      if( *pCurrent == '-' ) /* Long option? */
-      { /* Yes */
-         pCurrent++;
-         if( *pCurrent == '\0' )
-         {
-            fprintf( stderr, ESC_ERROR "%s: missing long option --???\n" ESC_END, ppAgv[0] );
-            return -1;
-         }
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+   return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+#endif
 
-         tl = 0;
-         while( (pCurrent[tl] != '\0') && (pCurrent[tl] != '=') )
-            tl++;
+#if !defined( CONFIG_CLOP_NO_TYPED_VALUES ) || defined( CONFIG_CLOP_STATISTICS )
+/*-----------------------------------------------------------------------------
+ * Converts value in decimal digits, returns the number of digits.
+ * The buffer needs at least 20 characters, it becomes not terminated.
+ */
+static size_t formatUnsigned( char* pBuffer, uint64_t value )
+{
+   char digits[20];
+   size_t n = 0;
+   size_t i;
 
-         FOR_EACH_OPTION_BLOCK( arg.pCurrentBlock, optBlockList )
-         {
-            if( arg.pCurrentBlock->longOpt == NULL )
-            {  /* In this case at least shortOpt must be defined! */
-               assert( arg.pCurrentBlock->shortOpt != 0 );
-               continue;
-            }
-            if( tl != strlen( arg.pCurrentBlock->longOpt ) )
-               continue;
-            if( strncmp( arg.pCurrentBlock->longOpt, pCurrent, tl ) != 0 )
-               continue;
-            break;
-         }
-         if( arg.pCurrentBlock->optFunction == NULL )
-         {
-            error = true;
-            fprintf( stderr, ESC_ERROR "%s: unrecognized long option --%s\n" ESC_END,
-                     ppAgv[0], pCurrent );
-            continue; /* Of: for( arg.argvIndex = 1; arg.argvIndex < argc; arg.argvIndex++ ) */
-         }
+   do
+   {
+      digits[n++] = '0' + (value % 10);
+      value /= 10;
+   }
+   while( value != 0 );
+   for( i = 0; i < n; i++ )
+      pBuffer[i] = digits[n - 1 - i];
+   return n;
+}
+#endif
 
-         switch( arg.pCurrentBlock->hasArg )
-         {
-         #ifndef CONFIG_CLOP_NO_NO_ARG
-            case NO_ARG:
-            {
-               _RETURN_HANDLING( arg.pCurrentBlock->optFunction( &arg ) )
-               break;
-            }
-         #endif /* ifndef CONFIG_CLOP_NO_NO_ARG */
-         #ifndef CONFIG_CLOP_NO_REQUIRED_ARG
-            case REQUIRED_ARG:
-            {
-               if( (arg.argvIndex+1) == argc )
-               {
-                  fprintf( stderr,
-                           ESC_ERROR "%s: missing argument of long option --%s\n" ESC_END,
-                           ppAgv[0], arg.pCurrentBlock->longOpt );
-                  return -1;
-               }
-               arg.argvIndex++;
-               arg.optArg = ppAgv[arg.argvIndex];
-               _RETURN_HANDLING( arg.pCurrentBlock->optFunction( &arg ) )
-               break;
-            }
-         #endif /* ifndef CONFIG_CLOP_NO_REQUIRED_ARG */
-         #ifndef CONFIG_CLOP_NO_OPTIONAL_ARG
-            case OPTIONAL_ARG:
-            {
-               if( pCurrent[tl] == '\0' )
-               {
-                  if( ((arg.argvIndex+1) == argc) || (ppAgv[arg.argvIndex+1][0] != '=') )
-                  {  /* No argument */
-                     _RETURN_HANDLING( arg.pCurrentBlock->optFunction( &arg ) )
-                     break;
-                  }
-                  if( ppAgv[arg.argvIndex+1][0] == '=' )
-                  {
-                     arg.argvIndex++;
-                     if( ppAgv[arg.argvIndex][1] != '\0' )
-                     {  /* "--OPTION =ARGUMENT" */
-                        arg.optArg = &ppAgv[arg.argvIndex][1];
-                        _RETURN_HANDLING( arg.pCurrentBlock->optFunction( &arg ) )
-                        break;
-                     }
-                     if( (arg.argvIndex+1) == argc )
-                     {
-                        longOptionalOptionErrorMessage( ppAgv[0],
-                                                        arg.pCurrentBlock->longOpt );
-                        return -1;
-                     }
-                     /* "--OPTION = ARGUMENT" */
-                     arg.argvIndex++;
-                     arg.optArg = ppAgv[arg.argvIndex];
-                     _RETURN_HANDLING( arg.pCurrentBlock->optFunction( &arg ) )
-                  }
-                  break;
-               } /* if( pCurrent[tl] == '\0' ) */
-               if( pCurrent[tl+1] != '\0' )
-               {  /* "--OPTION=ARGUMENT" */
-                  arg.optArg = &pCurrent[tl+1];
-                  _RETURN_HANDLING( arg.pCurrentBlock->optFunction( &arg ) )
-                  break;
-               }
-               if( (arg.argvIndex+1) == argc )
-               {
-                  longOptionalOptionErrorMessage( ppAgv[0],
-                                                  arg.pCurrentBlock->longOpt );
-                  return -1;
-               }
-               /* "--OPTION= ARGUMENT" */
-               arg.argvIndex++;
-               arg.optArg = ppAgv[arg.argvIndex];
-               _RETURN_HANDLING( arg.pCurrentBlock->optFunction( &arg ) )
-               break;
-            } /* End of case OPTIONAL_ARG: */
-         #endif /* ifndef CONFIG_CLOP_NO_OPTIONAL_ARG */
-            default: assert( false ); break;
-         } /* End of switch( arg.pCurrentBlock->hasArg ) */
-         continue; /* for( i = arg.argvIndex; arg.argvIndex < argc; arg.argvIndex++ ) */
-      } /* if( *pCurrent == '-' ) End of long-option parsing. */
+/*-----------------------------------------------------------------------------
+ * Compares the long option of the block with index i by the name pool of
+ * the table, without touching the block itself. The terminating '\0' in
+ * the pool stands for the length check, that saves the load of pLengths[]
+ * after the hash value has already matched.
+*/
+static inline bool isLongOptionOf( const struct OPTION_TABLE_T* pTable, uint32_t i,
+                                   const char* pName, size_t len )
+{
+   const char* pPoolName = &pTable->pNamePool[pTable->pNameOffsets[i]];
 
-      while( *pCurrent != '\0' ) /* short option */
-      {
-         FOR_EACH_OPTION_BLOCK( arg.pCurrentBlock, optBlockList )
-         {
-            if( arg.pCurrentBlock->shortOpt == 0 )
-            {  /*In this case at least longOpt musr be defined! */
-               assert( arg.pCurrentBlock->longOpt != NULL );
-               continue;
-            }
-            if( arg.pCurrentBlock->shortOpt != *pCurrent )
-               continue;
-            break;
-         }
-         if( arg.pCurrentBlock->optFunction == NULL )
-         {
-            error = true;
-            fprintf( stderr,
-                     ESC_ERROR "%s: unrecognized option -%c\n" ESC_END,
-                     ppAgv[0], *pCurrent );
-            pCurrent++;
-            continue;
-         }
+   return (memcmp( pPoolName, pName, len ) == 0) && (pPoolName[len] == '\0');
+}
 
-         switch( arg.pCurrentBlock->hasArg )
-         {
-         #ifndef CONFIG_CLOP_NO_NO_ARG
-            case NO_ARG:
-            {
-               _RETURN_HANDLING( arg.pCurrentBlock->optFunction( &arg ) )
-               break;
-            }
-         #endif    
-         #ifndef CONFIG_CLOP_NO_REQUIRED_ARG
-            case REQUIRED_ARG:
-            {
-               if( (pCurrent[1] == '\0') && ((arg.argvIndex+1) == argc) )
-               {
-                  fprintf( stderr,
-                           ESC_ERROR "%s: missing argument for option \'%c\'\n" ESC_END,
-                           ppAgv[0], *pCurrent );
-                  return -1;
-               }
-               if( pCurrent[1] != '\0' )
-               {
-                  arg.optArg = &pCurrent[1];
-                  _RETURN_HANDLING( arg.pCurrentBlock->optFunction( &arg ) )
+/*-----------------------------------------------------------------------------
+*/
+static const struct OPTION_BLOCK_T*
+findLongOptionInTable( const struct OPTION_TABLE_T* pTable,
+                       const char* pName, size_t len, uint32_t hash )
+{
+   const struct OPTION_HASH_SLOT_T* pSlot;
+   uint32_t i;
 
-                  do
-                     pCurrent++;
-                  while( pCurrent[1] != '\0' );
-               }
-               else
-               {
-                  arg.argvIndex++;
-                  arg.optArg = ppAgv[arg.argvIndex];
-                  _RETURN_HANDLING( arg.pCurrentBlock->optFunction( &arg ) )
-               }
-               break;
-            }
-         #endif /* ifndef CONFIG_CLOP_NO_REQUIRED_ARG */
-         #ifndef CONFIG_CLOP_NO_OPTIONAL_ARG
-            case OPTIONAL_ARG:
-            {
-               if( pCurrent[1] == '=' )
-               {
-                  pCurrent++;
-                  if( pCurrent[1] != '\0' )
-                     arg.optArg = &pCurrent[1]; /* "-O=ARGUMENT" */
-                  else if( (arg.argvIndex+1) < argc )
-                  {
-                     arg.argvIndex++; /* "-O= ARGUMENT" */
-                     arg.optArg = ppAgv[arg.argvIndex];
-                  }
-                  else
-                  {
-                     shortOptionalOptionErrorMessage( ppAgv[0],
-                                                      arg.pCurrentBlock->shortOpt );
-                     return -1;
-                  }
-               }
-               else if( (pCurrent[1] == '\0') && ((arg.argvIndex+1) < argc) )
-               {
-                  if( ppAgv[arg.argvIndex+1][0] == '=' )
-                  {
-                     arg.argvIndex++;
-                     if( ppAgv[arg.argvIndex][1] != '\0' )
-                        arg.optArg = &ppAgv[arg.argvIndex][1]; /* "-O =ARGUMENT" */
-                     else
-                     {
-                        if( (arg.argvIndex+1) < argc )
-                        {  /* "-O = ARGUMENT" */
-                           arg.argvIndex++;
-                           arg.optArg = ppAgv[arg.argvIndex];
-                        }
-                        else
-                        {
-                           shortOptionalOptionErrorMessage( ppAgv[0],
-                                                            arg.pCurrentBlock->shortOpt );
-                           return -1;
-                        }
-                     }
-                  }
-               }
+   if( pTable->pSeeds != NULL )
+   {  /* Perfect hash index, made by clop-gen: exact one probe. */
+      i = optionSeedHash( hash, pTable->pSeeds[hash & pTable->seedMask] )
+          % pTable->numOfSlots;
+      pSlot = &pTable->pSlots[i];
+      if( (pSlot->index != 0) && (pSlot->hash == hash) &&
+          isLongOptionOf( pTable, pSlot->index - 1, pName, len ) )
+         return &pTable->pOptBlockList[pSlot->index - 1];
+      return NULL;
+   }
 
-               _RETURN_HANDLING( arg.pCurrentBlock->optFunction( &arg ) )
+   i = hash & pTable->slotMask;
+   while( true )
+   {
+      pSlot = &pTable->pSlots[i];
+      if( pSlot->index == 0 )
+         return NULL;
+      if( (pSlot->hash == hash) &&
+          isLongOptionOf( pTable, pSlot->index - 1, pName, len ) )
+         return &pTable->pOptBlockList[pSlot->index - 1];
+      i = (i + 1) & pTable->slotMask;
+   }
+}
 
-               if( arg.optArg == NULL )
-                  break;
+/*-----------------------------------------------------------------------------
+*/
+static const struct OPTION_BLOCK_T*
+findLongOptionInList( struct OPTION_BLOCK_T optBlockList[],
+                      const char* pName, size_t len )
+{
+   BLK_LIST_ITERATOR_T pBlock;
 
-               while( pCurrent[1] != '\0' )
-                  pCurrent++;
-               break;
-            } /* End of case OPTIONAL_ARG */
-         #endif /* ifndef CONFIG_CLOP_NO_OPTIONAL_ARG */
-            default: assert( false ); break;
-         } /* End of switch( arg.pCurrentBlock->hasArg ) */
+   FOR_EACH_OPTION_BLOCK( pBlock, optBlockList )
+   {
+      if( pBlock->longOpt == NULL )
+         continue;
+      if( len != strlen( pBlock->longOpt ) )
+         continue;
+      if( strncmp( pBlock->longOpt, pName, len ) != 0 )
+         continue;
+      return pBlock;
+   }
+   return NULL;
+}
 
-         pCurrent++;
-      } /* while( *pCurrent != '\0' ) */
-   } /* for( arg.argvIndex = 1; arg.argvIndex < argc; arg.argvIndex++ ) */
-   return error? -1 : arg.argvIndex;
+#ifndef CONFIG_CLOP_NO_SIMD
+/*
+ * Matcher of the long options of all parse calls without compiled table.
+ * @see selectOptionMatcher
+ */
+static OPT_MATCHER_T g_optionMatcher = OPT_MATCHER_AUTO;
+
+/*-----------------------------------------------------------------------------
+*/
+static OPT_MATCHER_T bestOptionMatcher( void )
+{
+#ifdef HAVE_X86_SIMD
+   __builtin_cpu_init();
+   if( __builtin_cpu_supports( "avx2" ) )
+      return OPT_MATCHER_AVX2;
+   if( __builtin_cpu_supports( "sse2" ) )
+      return OPT_MATCHER_SSE2;
+#endif
+   return OPT_MATCHER_SCALAR;
 }
 
-/*!-----------------------------------------------------------------------------
+/*!----------------------------------------------------------------------------
 @see parse_opts.h
 */
-void printOption( FILE* pStream, const struct OPTION_BLOCK_T* pOptionBlock )
+OPT_MATCHER_T selectOptionMatcher( OPT_MATCHER_T matcher )
 {
-   const char* pParam = "";
-   assert( (pOptionBlock->shortOpt != 0) || (pOptionBlock->longOpt != NULL) );
+   const OPT_MATCHER_T best = bestOptionMatcher();
 
-   switch( pOptionBlock->hasArg )
-   {
-   #ifndef CONFIG_CLOP_NO_NO_ARG
-      case NO_ARG:                             break;
-   #endif
-   #ifndef CONFIG_CLOP_NO_REQUIRED_ARG
-      case REQUIRED_ARG: pParam = " PARAM";    break;
-   #endif
-   #ifndef CONFIG_CLOP_NO_OPTIONAL_ARG
-      case OPTIONAL_ARG: pParam = " [=PARAM]"; break;
-   #endif
-      default: assert( false ); break;
-   }
+   if( (matcher == OPT_MATCHER_AUTO) || (matcher > best) )
+      matcher = best;
+   __atomic_store_n( &g_optionMatcher, matcher, __ATOMIC_RELAXED );
+   return matcher;
+}
+#endif /* ifndef CONFIG_CLOP_NO_SIMD */
 
-   if( pOptionBlock->shortOpt != 0 )
+#ifdef HAVE_X86_SIMD
+/*
+ * Block-lists with less blocks becomes scanned by OPT_MATCHER_SCALAR,
+ * building the keys would cost more than it saves.
+ */
+#define MIN_KEYED_BLOCKS 16
+
+/*
+ * The key arrays are padded to a multiple of this, so the matchers need
+ * no scalar tail.
+ */
+#define KEY_GROUP_SIZE 16
+
+#define KEY_LENGTH_CLIPPED 0xFFFE /* Name length >= 0xFFFE, compare it fully. */
+#define KEY_LENGTH_NONE    0xFFFF /* Block without long option or padding. */
+
+/*
+ * Packed keys of the long options of a block-list, built on the second long
+ * option of a parse call. Element i belongs to the block optBlockList[i].
+ */
+struct OPTION_KEYS_T
+{
+   OPT_MATCHER_T          matcher;
+   bool                   built;
+   uint32_t               lookups;
+   uint32_t               numOfKeys;
+   struct OPTION_BLOCK_T* pOptBlockList;
+   uint64_t*              pChars;   /* @see keyCharacters */
+   uint16_t*              pLengths;
+};
+
+/*-----------------------------------------------------------------------------
+ * Names up to 8 characters zero padded, longer ones by the first and the
+ * last 4 characters. The latter distinguishes names like "enable-foo" and
+ * "enable-bar" better than the first 8 characters.
+ */
+static inline uint64_t keyCharacters( const char* pName, size_t len )
+{
+   uint32_t first, last;
+   uint64_t chars = 0;
+
+   if( len <= sizeof( chars ) )
    {
-      fprintf( pStream, "-%c%s", pOptionBlock->shortOpt, pParam );
-      if( pOptionBlock->longOpt != NULL )
-         fprintf( pStream, ", " );
+      memcpy( &chars, pName, len );
+      return chars;
    }
-   if( pOptionBlock->longOpt != NULL )
-      fprintf( pStream, "--%s%s", pOptionBlock->longOpt, pParam );
+   memcpy( &first, pName, sizeof( first ) );
+   memcpy( &last, &pName[len - sizeof( last )], sizeof( last ) );
+   return first | ((uint64_t)last << 32);
 }
 
-/*!----------------------------------------------------------------------------
-@see parse_opts.h
+/*-----------------------------------------------------------------------------
 */
-void printOptionList( FILE* pStream, struct OPTION_BLOCK_T optBlockList[] )
+static inline uint16_t keyLength( size_t len )
+{
+   return (len < KEY_LENGTH_CLIPPED)? (uint16_t)len : KEY_LENGTH_CLIPPED;
+}
+
+/*-----------------------------------------------------------------------------
+ * Returns the keys for the parse call if the vectorized matching is selected
+ * and no table is given, otherwise NULL.
+ */
+static struct OPTION_KEYS_T* prepareKeys( struct OPTION_KEYS_T* pKeys,
+                                          const struct OPTION_CONTEXT_T* pContext )
+{
+   OPT_MATCHER_T matcher;
+
+   if( pContext->pTable != NULL )
+      return NULL;
+   matcher = __atomic_load_n( &g_optionMatcher, __ATOMIC_RELAXED );
+   if( matcher == OPT_MATCHER_AUTO )
+      matcher = selectOptionMatcher( OPT_MATCHER_AUTO );
+   if( matcher == OPT_MATCHER_SCALAR )
+      return NULL;
+
+   pKeys->matcher       = matcher;
+   pKeys->built         = false;
+   pKeys->numOfKeys     = 0;
+   pKeys->lookups       = 0;
+   pKeys->pOptBlockList = pContext->pOptBlockList;
+   pKeys->pChars        = NULL;
+   pKeys->pLengths      = NULL;
+   return pKeys;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void releaseKeys( struct OPTION_KEYS_T* pKeys )
+{
+   if( pKeys != NULL )
+      free( pKeys->pChars );
+}
+
+/*-----------------------------------------------------------------------------
+ * Leaves pKeys->pChars NULL for short block-lists and when the memory
+ * is exhausted, then the block-list becomes scanned as usual.
+ */
+static void buildKeys( struct OPTION_KEYS_T* pKeys )
 {
-   const char* pC;
    BLK_LIST_ITERATOR_T pBlock;
+   uint32_t n = 0;
+   uint32_t i;
+   size_t len;
 
-   FOR_EACH_OPTION_BLOCK( pBlock, optBlockList )
+   pKeys->built = true;
+   FOR_EACH_OPTION_BLOCK( pBlock, pKeys->pOptBlockList )
+      n++;
+   if( n < MIN_KEYED_BLOCKS )
+      return;
+
+   pKeys->numOfKeys = (n + KEY_GROUP_SIZE - 1) & ~(uint32_t)(KEY_GROUP_SIZE - 1);
+   pKeys->pChars = malloc( pKeys->numOfKeys *
+                           (sizeof( uint64_t ) + sizeof( uint16_t )) );
+   if( pKeys->pChars == NULL )
+      return;
+   pKeys->pLengths = (uint16_t*)&pKeys->pChars[pKeys->numOfKeys];
+
+   for( i = 0; i < pKeys->numOfKeys; i++ )
    {
-      assert( (pBlock->shortOpt != 0) || (pBlock->longOpt != NULL) );
-      fprintf( pStream, "  " );
-      printOption( pStream, pBlock );
-      fprintf( pStream, "\n\t" );
-      if( pBlock->helpText != NULL )
+      const char* longOpt = (i < n)? pKeys->pOptBlockList[i].longOpt : NULL;
+      if( longOpt == NULL )
       {
-         pC = pBlock->helpText;
-         while( *pC != '\0' )
-         {
-            if( *pC == '\n' )
-               fprintf( pStream, "\n\t" );
-            else
-               fprintf( pStream, "%c", *pC );
-            pC++;
-         }
+         pKeys->pChars[i]   = 0;
+         pKeys->pLengths[i] = KEY_LENGTH_NONE;
+         continue;
+      }
+      len = strlen( longOpt );
+      pKeys->pChars[i]   = keyCharacters( longOpt, len );
+      pKeys->pLengths[i] = keyLength( len );
+   }
+}
+
+/*-----------------------------------------------------------------------------
+ * The keys of the block i and of the name are equal, so the length, the
+ * first and the last 4 characters are equal too, apart from clipped lengths.
+ */
+static inline bool isKeyedLongOption( const struct OPTION_KEYS_T* pKeys,
+                                      uint32_t i, const char* pName, size_t len )
+{
+   const char* longOpt = pKeys->pOptBlockList[i].longOpt;
+
+   if( (pKeys->pLengths[i] == KEY_LENGTH_CLIPPED) && (strlen( longOpt ) != len) )
+      return false;
+   return (len <= sizeof( uint64_t )) ||
+          (memcmp( &longOpt[4], &pName[4], len - sizeof( uint64_t ) ) == 0);
+}
+
+/*-----------------------------------------------------------------------------
+ * Each block has two bits in the masks, the first equal key in the
+ * ascending order of the bits wins like by the scalar scan.
+ */
+#define FIND_KEY_IN_MASK( pKeys, base, charMask, lengthMask, pName, len ) \
+   do                                                                       \
+   {                                                                        \
+      uint32_t _m = (charMask) & (lengthMask);                            \
+      _m &= (_m >> 1) & 0x55555555U;                                        \
+      while( _m != 0 )                                                      \
+      {                                                                     \
+         uint32_t _i = (base) + (uint32_t)__builtin_ctz( _m ) / 2;          \
+         if( isKeyedLongOption( pKeys, _i, pName, len ) )                   \
+            return &(pKeys)->pOptBlockList[_i];                             \
+         _m &= _m - 1;                                                      \
+      }                                                                     \
+   }                                                                        \
+   while( false )
+
+/*-----------------------------------------------------------------------------
+ * Compares 8 keys at a time.
+ */
+__attribute__(( target( "sse2" ) ))
+static const struct OPTION_BLOCK_T*
+findKeySse2( const struct OPTION_KEYS_T* pKeys, uint64_t chars, uint16_t length,
+             const char* pName, size_t len )
+{
+   const __m128i vChars = _mm_set1_epi64x( (long long)chars );
+   const __m128i vLength = _mm_set1_epi16( (short)length );
+   uint32_t i, j;
+
+   for( i = 0; i < pKeys->numOfKeys; i += 8 )
+   {
+      uint32_t charMask = 0;
+      for( j = 0; j < 4; j++ )
+      {
+         __m128i v = _mm_loadu_si128( (const __m128i*)&pKeys->pChars[i + 2 * j] );
+         charMask |= (uint32_t)_mm_movemask_ps(
+                          _mm_castsi128_ps( _mm_cmpeq_epi32( v, vChars ) ) ) << (4 * j);
       }
-      fprintf( pStream, "\n\n" );
+      __m128i v = _mm_loadu_si128( (const __m128i*)&pKeys->pLengths[i] );
+      uint32_t lengthMask = (uint32_t)_mm_movemask_epi8( _mm_cmpeq_epi16( v, vLength ) );
+      FIND_KEY_IN_MASK( pKeys, i, charMask, lengthMask, pName, len );
    }
+   return NULL;
+}
+
+/*-----------------------------------------------------------------------------
+ * Compares 16 keys at a time.
+ */
+__attribute__(( target( "avx2" ) ))
+static const struct OPTION_BLOCK_T*
+findKeyAvx2( const struct OPTION_KEYS_T* pKeys, uint64_t chars, uint16_t length,
+             const char* pName, size_t len )
+{
+   const __m256i vChars = _mm256_set1_epi64x( (long long)chars );
+   const __m256i vLength = _mm256_set1_epi16( (short)length );
+   uint32_t i, j;
+
+   for( i = 0; i < pKeys->numOfKeys; i += 16 )
+   {
+      uint32_t charMask = 0;
+      for( j = 0; j < 4; j++ )
+      {
+         __m256i v = _mm256_loadu_si256( (const __m256i*)&pKeys->pChars[i + 4 * j] );
+         charMask |= (uint32_t)_mm256_movemask_ps(
+                          _mm256_castsi256_ps( _mm256_cmpeq_epi64( v, vChars ) ) ) << (8 * j);
+      }
+      __m256i v = _mm256_loadu_si256( (const __m256i*)&pKeys->pLengths[i] );
+      uint32_t lengthMask = (uint32_t)_mm256_movemask_epi8( _mm256_cmpeq_epi16( v, vLength ) );
+      FIND_KEY_IN_MASK( pKeys, i, charMask, lengthMask, pName, len );
+   }
+   return NULL;
+}
+
+/*-----------------------------------------------------------------------------
+ * Same result like findLongOptionInList(). The keys becomes built not until
+ * the second long option, building costs about as much as a scalar lookup,
+ * so a command line with a single long option doesn't pay for it.
+ */
+static const struct OPTION_BLOCK_T*
+findLongOptionByKeys( struct OPTION_KEYS_T* pKeys, const char* pName, size_t len )
+{
+   if( !pKeys->built )
+   {
+      if( pKeys->lookups++ == 0 )
+         return findLongOptionInList( pKeys->pOptBlockList, pName, len );
+      buildKeys( pKeys );
+   }
+   if( pKeys->pChars == NULL )
+      return findLongOptionInList( pKeys->pOptBlockList, pName, len );
+   if( pKeys->matcher == OPT_MATCHER_AVX2 )
+      return findKeyAvx2( pKeys, keyCharacters( pName, len ), keyLength( len ), pName, len );
+   return findKeySse2( pKeys, keyCharacters( pName, len ), keyLength( len ), pName, len );
+}
+
+/*-----------------------------------------------------------------------------
+ * Length of the long option name at pCurrent until '=' or the end of the
+ * argument. The aligned loads never cross a page boundary, but they may
+ * read behind the terminating zero, therefore excluded from the address
+ * sanitizer.
+ */
+__attribute__(( target( "sse2" ), no_sanitize_address ))
+static size_t scanLongOptionName( const char* pCurrent )
+{
+   const __m128i vEqual = _mm_set1_epi8( '=' );
+   const __m128i vZero  = _mm_setzero_si128();
+   const size_t misalignment = (uintptr_t)pCurrent & 15;
+   const __m128i* pBlock = (const __m128i*)(pCurrent - misalignment);
+   size_t tl = 16 - misalignment;
+   __m128i v = _mm_load_si128( pBlock );
+   uint32_t mask = (uint32_t)_mm_movemask_epi8( _mm_or_si128( _mm_cmpeq_epi8( v, vEqual ),
+                                                              _mm_cmpeq_epi8( v, vZero ) ) )
+                   >> misalignment;
+   if( mask != 0 )
+      return (uint32_t)__builtin_ctz( mask );
+
+   while( true )
+   {
+      v = _mm_load_si128( ++pBlock );
+      mask = (uint32_t)_mm_movemask_epi8( _mm_or_si128( _mm_cmpeq_epi8( v, vEqual ),
+                                                        _mm_cmpeq_epi8( v, vZero ) ) );
+      if( mask != 0 )
+         return tl + (uint32_t)__builtin_ctz( mask );
+      tl += 16;
+   }
+}
+#endif /* ifdef HAVE_X86_SIMD */
+
+/*-----------------------------------------------------------------------------
+*/
+static const struct OPTION_BLOCK_T*
+findShortOptionInList( struct OPTION_BLOCK_T optBlockList[], char shortOpt )
+{
+   BLK_LIST_ITERATOR_T pBlock;
+
+   FOR_EACH_OPTION_BLOCK( pBlock, optBlockList )
+   {
+      if( pBlock->shortOpt == shortOpt )
+         return pBlock;
+   }
+   return NULL;
+}
+
+#ifndef CONFIG_CLOP_FREESTANDING
+/*
+ * Program name of the messages of validateOptionBlockList().
+ */
+#define VALIDATION_NAME "option block-list"
+
+/*-----------------------------------------------------------------------------
+*/
+static void reportBlockError( struct OPTION_ERROR_SINK_T* pSink,
+                              OPT_ERROR_CODE_T code,
+                              int index,
+                              const struct OPTION_BLOCK_T* pBlock,
+                              const char* pToken,
+                              const struct OPTION_BLOCK_T* pConflictBlock )
+{
+   struct OPTION_ERROR_T error =
+   {
+      .code           = code,
+      .argvIndex      = index,
+      .pToken         = pToken,
+      .tokenLength    = (pToken != NULL)? strlen( pToken ) : 0,
+      .pBlock         = pBlock,
+      .pConflictBlock = pConflictBlock
+   };
+   reportError( pSink, VALIDATION_NAME, &error );
+}
+
+/*-----------------------------------------------------------------------------
+ * Returns the description of the defect or NULL if the block is all right.
+ */
+static const char* checkOptionBlock( const struct OPTION_BLOCK_T* pBlock )
+{
+   if( (pBlock->shortOpt == 0) && (pBlock->longOpt == NULL) )
+      return "without option name";
+
+   switch( pBlock->hasArg )
+   {
+   #ifndef CONFIG_CLOP_NO_NO_ARG
+      case NO_ARG:       break;
+   #endif
+   #ifndef CONFIG_CLOP_NO_REQUIRED_ARG
+      case REQUIRED_ARG: break;
+   #endif
+   #ifndef CONFIG_CLOP_NO_OPTIONAL_ARG
+      case OPTIONAL_ARG: break;
+   #endif
+      default: return "with invalid or excluded argument kind";
+   }
+
+#ifndef CONFIG_CLOP_NO_TYPED_VALUES
+   if( pBlock->optFunction != storeOptionValue )
+      return NULL;
+   switch( pBlock->valueType )
+   {
+      case OPT_TYPE_NONE:
+      {
+         return "without value type for storeOptionValue()";
+      }
+      case OPT_TYPE_SET_BIT:
+      {
+         if( (unsigned int)pBlock->id >= (sizeof( unsigned int ) * 8) )
+            return "with bit number out of range";
+         break;
+      }
+      case OPT_TYPE_ENUM:
+      {
+         if( pBlock->pValueInfo == NULL )
+            return "without enum names";
+         break;
+      }
+      default:
+      {
+         if( (unsigned int)pBlock->valueType > OPT_TYPE_LIST )
+            return "with invalid value type";
+         break;
+      }
+   }
+#endif
+   return NULL;
+}
+
+/*-----------------------------------------------------------------------------
+ * By name and equal names in the order of the block-list.
+ */
+static int compareLongOptions( const void* p1, const void* p2 )
+{
+   const struct OPTION_BLOCK_T* pBlock1 = *(const struct OPTION_BLOCK_T* const*)p1;
+   const struct OPTION_BLOCK_T* pBlock2 = *(const struct OPTION_BLOCK_T* const*)p2;
+   int ret = strcmp( pBlock1->longOpt, pBlock2->longOpt );
+
+   if( ret != 0 )
+      return ret;
+   return (pBlock1 < pBlock2)? -1 : (pBlock1 > pBlock2);
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int validateOptionBlockList( struct OPTION_BLOCK_T optBlockList[],
+                             struct OPTION_ERROR_SINK_T* pSink )
+{
+   const struct OPTION_BLOCK_T* shortOwner[256] = { NULL };
+   const struct OPTION_BLOCK_T** ppSorted;
+   BLK_LIST_ITERATOR_T pBlock;
+   const char* pDefect;
+   size_t numOfLongOpts = 0;
+   size_t i, first;
+   int findings = 0;
+
+   FOR_EACH_OPTION_BLOCK( pBlock, optBlockList )
+   {
+      const int index = (int)(pBlock - optBlockList);
+
+      pDefect = checkOptionBlock( pBlock );
+      if( pDefect != NULL )
+      {
+         reportBlockError( pSink, OPT_ERR_INVALID_OPTION_BLOCK, index, pBlock,
+                           pDefect, NULL );
+         findings++;
+         continue;
+      }
+
+      if( pBlock->shortOpt != 0 )
+      {
+      #ifndef CONFIG_NO_NEGATIVE_NUMBERS_IN_NON_OPTION_ARGUMENTS
+         if( (pBlock->shortOpt == '-') ||
+             ((pBlock->shortOpt >= '0') && (pBlock->shortOpt <= '9')) )
+      #else
+         if( pBlock->shortOpt == '-' )
+      #endif
+         {  /* "--" begins a long option, "-1" is a negative number. */
+            reportBlockError( pSink, OPT_ERR_UNREACHABLE_OPTION, index, pBlock,
+                              NULL, NULL );
+            findings++;
+         }
+         else if( shortOwner[(uint8_t)pBlock->shortOpt] != NULL )
+         {
+            reportBlockError( pSink, OPT_ERR_DUPLICATE_SHORT_OPTION, index,
+                              pBlock, NULL, shortOwner[(uint8_t)pBlock->shortOpt] );
+            findings++;
+         }
+         else
+            shortOwner[(uint8_t)pBlock->shortOpt] = pBlock;
+      }
+
+      if( pBlock->longOpt != NULL )
+      {
+         if( (pBlock->longOpt[0] == '\0') || (strchr( pBlock->longOpt, '=' ) != NULL) )
+         {
+            reportBlockError( pSink, OPT_ERR_UNREACHABLE_OPTION, index, pBlock,
+                              pBlock->longOpt, NULL );
+            findings++;
+         }
+         else
+            numOfLongOpts++;
+      }
+   }
+
+   if( numOfLongOpts < 2 )
+      return findings;
+
+   /* Duplicate long names are neighbors after sorting. */
+   ppSorted = malloc( numOfLongOpts * sizeof( struct OPTION_BLOCK_T* ) );
+   if( ppSorted == NULL )
+      return -1;
+   i = 0;
+   FOR_EACH_OPTION_BLOCK( pBlock, optBlockList )
+   {
+      if( (pBlock->longOpt != NULL) && (pBlock->longOpt[0] != '\0') &&
+          (strchr( pBlock->longOpt, '=' ) == NULL) &&
+          (checkOptionBlock( pBlock ) == NULL) )
+         ppSorted[i++] = pBlock;
+   }
+   qsort( ppSorted, numOfLongOpts, sizeof( struct OPTION_BLOCK_T* ),
+          compareLongOptions );
+   for( first = 0, i = 1; i < numOfLongOpts; i++ )
+   {
+      if( strcmp( ppSorted[first]->longOpt, ppSorted[i]->longOpt ) != 0 )
+      {
+         first = i;
+         continue;
+      }
+      reportBlockError( pSink, OPT_ERR_DUPLICATE_LONG_OPTION,
+                        (int)(ppSorted[i] - optBlockList), ppSorted[i],
+                        ppSorted[i]->longOpt, ppSorted[first] );
+      findings++;
+   }
+   free( (void*)ppSorted );
+   return findings;
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int initOptionTable( struct OPTION_TABLE_T* pTable,
+                     struct OPTION_BLOCK_T optBlockList[] )
+{
+   return initOptionTableWithSink( pTable, optBlockList, NULL );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int initOptionTableWithSink( struct OPTION_TABLE_T* pTable,
+                             struct OPTION_BLOCK_T optBlockList[],
+                             struct OPTION_ERROR_SINK_T* pSink )
+{
+   BLK_LIST_ITERATOR_T pBlock;
+   struct OPTION_HASH_SLOT_T* pSlots;
+   uint32_t* pHashes;
+   uint32_t* pLengths;
+   uint32_t* pNameOffsets;
+   char* pShortOpts;
+   char* pNamePool;
+   size_t numOfSlots = 2;
+   size_t numOfBlocks = 0;
+   size_t numOfLongOpts = 0;
+   size_t poolSize = 0;
+   size_t len;
+   uint32_t hash, i, n;
+   int findings;
+
+   /* Once here instead of per argument in the parser. */
+   findings = validateOptionBlockList( optBlockList, pSink );
+   if( findings < 0 )
+      return findings;
+
+   FOR_EACH_OPTION_BLOCK( pBlock, optBlockList )
+   {
+      numOfBlocks++;
+      if( pBlock->longOpt == NULL )
+         continue;
+      numOfLongOpts++;
+      poolSize += strlen( pBlock->longOpt ) + 1;
+   }
+
+   /* Load factor of maximum 50% keeps the probe sequences short. */
+   while( numOfSlots < (2 * numOfLongOpts) )
+      numOfSlots *= 2;
+
+   /*
+    * One allocation for the hash index and the structure of arrays,
+    * the 32 bit arrays first because of the alignment.
+    */
+   pSlots = calloc( 1, numOfSlots * sizeof( struct OPTION_HASH_SLOT_T ) +
+                       numOfBlocks * (3 * sizeof( uint32_t ) + sizeof( char )) +
+                       poolSize );
+   if( pSlots == NULL )
+      return -1;
+   pHashes      = (uint32_t*)&pSlots[numOfSlots];
+   pLengths     = &pHashes[numOfBlocks];
+   pNameOffsets = &pLengths[numOfBlocks];
+   pShortOpts   = (char*)&pNameOffsets[numOfBlocks];
+   pNamePool    = &pShortOpts[numOfBlocks];
+
+   pTable->pOptBlockList = optBlockList;
+   pTable->pSlots        = pSlots;
+   pTable->slotMask      = numOfSlots - 1;
+   pTable->numOfSlots    = numOfSlots;
+   pTable->pSeeds        = NULL;
+   pTable->seedMask      = 0;
+   pTable->numOfBlocks   = numOfBlocks;
+   pTable->pShortOpts    = pShortOpts;
+   pTable->pHashes       = pHashes;
+   pTable->pLengths      = pLengths;
+   pTable->pNameOffsets  = pNameOffsets;
+   pTable->pNamePool     = pNamePool;
+   pTable->ppPrefixIndex = NULL;
+   pTable->numOfPrefixes = 0;
+   memset( pTable->shortOptIndex, 0, sizeof( pTable->shortOptIndex ) );
+
+   n = 0;
+   poolSize = 0;
+   FOR_EACH_OPTION_BLOCK( pBlock, optBlockList )
+   {
+      pShortOpts[n] = pBlock->shortOpt;
+      if( (pBlock->shortOpt != 0) &&
+          (pTable->shortOptIndex[(uint8_t)pBlock->shortOpt] == NULL) )
+         pTable->shortOptIndex[(uint8_t)pBlock->shortOpt] = pBlock;
+
+      if( pBlock->longOpt != NULL )
+      {
+         len = strlen( pBlock->longOpt );
+         pHashes[n]      = optionNameHash( pBlock->longOpt, len );
+         pLengths[n]     = len;
+         pNameOffsets[n] = poolSize;
+         memcpy( &pNamePool[poolSize], pBlock->longOpt, len + 1 );
+         poolSize += len + 1;
+      }
+      n++;
+   }
+
+   for( n = 0; n < numOfBlocks; n++ )
+   {
+      if( optBlockList[n].longOpt == NULL )
+         continue;
+      hash = pHashes[n];
+      if( findLongOptionInTable( pTable, optBlockList[n].longOpt, pLengths[n], hash ) != NULL )
+         continue; /* Duplicate name, the first one wins. */
+      i = hash & pTable->slotMask;
+      while( pSlots[i].index != 0 )
+         i = (i + 1) & pTable->slotMask;
+      pSlots[i].hash  = hash;
+      pSlots[i].index = n + 1;
+   }
+   return findings;
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void freeOptionTable( struct OPTION_TABLE_T* pTable )
+{
+   /* The structure of arrays is part of the allocation of the hash index. */
+   free( (void*)pTable->pSlots );
+   pTable->pSlots        = NULL;
+   pTable->pHashes       = NULL;
+   pTable->pLengths      = NULL;
+   pTable->pNameOffsets  = NULL;
+   pTable->pShortOpts    = NULL;
+   pTable->pNamePool     = NULL;
+   pTable->numOfBlocks   = 0;
+   free( (void*)pTable->ppPrefixIndex );
+   pTable->ppPrefixIndex = NULL;
+   pTable->numOfPrefixes = 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int comparePrefixIndex( const void* p1, const void* p2 )
+{
+   return strcmp( (*(const struct OPTION_BLOCK_T* const*)p1)->longOpt,
+                  (*(const struct OPTION_BLOCK_T* const*)p2)->longOpt );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int enableOptionPrefixMatching( struct OPTION_TABLE_T* pTable )
+{
+   const struct OPTION_BLOCK_T** ppIndex;
+   uint32_t i, n;
+
+   /* The hash index contains each long name exact once. */
+   n = 0;
+   for( i = 0; i < pTable->numOfSlots; i++ )
+   {
+      if( pTable->pSlots[i].index != 0 )
+         n++;
+   }
+
+   ppIndex = malloc( (n + 1) * sizeof( struct OPTION_BLOCK_T* ) );
+   if( ppIndex == NULL )
+      return -1;
+
+   n = 0;
+   for( i = 0; i < pTable->numOfSlots; i++ )
+   {
+      if( pTable->pSlots[i].index != 0 )
+         ppIndex[n++] = &pTable->pOptBlockList[pTable->pSlots[i].index - 1];
+   }
+   qsort( ppIndex, n, sizeof( struct OPTION_BLOCK_T* ), comparePrefixIndex );
+
+   free( (void*)pTable->ppPrefixIndex );
+   pTable->ppPrefixIndex = ppIndex;
+   pTable->numOfPrefixes = n;
+   return 0;
+}
+#endif /* ifndef CONFIG_CLOP_FREESTANDING */
+
+/*-----------------------------------------------------------------------------
+ * Binary search of all long options beginning with the first len characters
+ * of pName. They form a coherent range in the sorted index.
+ * Returns the number of the found options, *pFirst is the index of the first
+ * one.
+ */
+static uint32_t findPrefixRange( const struct OPTION_TABLE_T* pTable,
+                                 const char* pName, size_t len, uint32_t* pFirst )
+{
+   const struct OPTION_BLOCK_T* const* ppIndex = pTable->ppPrefixIndex;
+   uint32_t lower, upper, middle;
+
+   lower = 0;
+   upper = pTable->numOfPrefixes;
+   while( lower < upper )
+   {
+      middle = lower + (upper - lower) / 2;
+      if( strncmp( ppIndex[middle]->longOpt, pName, len ) < 0 )
+         lower = middle + 1;
+      else
+         upper = middle;
+   }
+   *pFirst = lower;
+
+   upper = pTable->numOfPrefixes;
+   while( lower < upper )
+   {
+      middle = lower + (upper - lower) / 2;
+      if( strncmp( ppIndex[middle]->longOpt, pName, len ) <= 0 )
+         lower = middle + 1;
+      else
+         upper = middle;
+   }
+   return lower - *pFirst;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void initIterator( struct OPTION_ITERATOR_T* pIt,
+                          int offset,
+                          int argc,
+                          char* const ppAgv[],
+                          struct OPTION_BLOCK_T optBlockList[],
+                          const struct OPTION_TABLE_T* pTable )
+{
+   pIt->pBlock        = NULL;
+   pIt->optArg        = NULL;
+   pIt->argvIndex     = offset;
+   pIt->argc          = argc;
+   pIt->ppAgv         = ppAgv;
+   pIt->pOptBlockList = optBlockList;
+   pIt->pTable        = pTable;
+   pIt->limit         = argc;
+   pIt->nextIndex     = offset;
+   pIt->pCurrent      = NULL;
+   pIt->pErrorSink    = NULL;
+   pIt->pKeys         = NULL;
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void initOptionIterator( struct OPTION_ITERATOR_T* pIt,
+                         int offset,
+                         int argc,
+                         char* const ppAgv[],
+                         struct OPTION_BLOCK_T optBlockList[] )
+{
+   initIterator( pIt, offset, argc, ppAgv, optBlockList, NULL );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void initOptionIteratorTable( struct OPTION_ITERATOR_T* pIt,
+                              int offset,
+                              int argc,
+                              char* const ppAgv[],
+                              const struct OPTION_TABLE_T* pTable )
+{
+   assert( pTable != NULL );
+   initIterator( pIt, offset, argc, ppAgv, pTable->pOptBlockList, pTable );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void iteratorError( const struct OPTION_ITERATOR_T* pIt,
+                           OPT_ERROR_CODE_T code,
+                           const char* pToken,
+                           size_t tokenLength )
+{
+   struct OPTION_ERROR_T error =
+   {
+      .code        = code,
+      .argvIndex   = pIt->argvIndex,
+      .pToken      = pToken,
+      .tokenLength = tokenLength,
+      .pBlock      = pIt->pBlock
+   };
+   reportError( pIt->pErrorSink, pIt->ppAgv[0], &error );
+}
+
+/*-----------------------------------------------------------------------------
+ * Long option: "--OPTION", "--OPTION ARGUMENT", "--OPTION=ARGUMENT",
+ * "--OPTION =ARGUMENT", "--OPTION= ARGUMENT", "--OPTION = ARGUMENT"
+ */
+static OPT_ITER_RESULT_T nextLongOption( struct OPTION_ITERATOR_T* pIt,
+                                         char* pCurrent )
+{
+   char* const* ppAgv = pIt->ppAgv;
+   size_t tl;
+   uint32_t hash;
+
+   pCurrent++;
+   if( *pCurrent == '\0' )
+   {
+      iteratorError( pIt, OPT_ERR_MISSING_LONG_OPTION, pCurrent - 2, 2 );
+      return OPT_ITER_FATAL;
+   }
+
+   tl = 0;
+   if( pIt->pTable != NULL )
+   {  /* Scanning and hashing in the same loop. */
+      hash = OPTION_HASH_INIT;
+      while( (pCurrent[tl] != '\0') && (pCurrent[tl] != '=') )
+      {
+         hash = OPTION_HASH_STEP( hash, pCurrent[tl] );
+         tl++;
+      }
+      pIt->pBlock = findLongOptionInTable( pIt->pTable, pCurrent, tl, hash );
+      if( (pIt->pBlock == NULL) && (tl > 0) &&
+          (pIt->pTable->ppPrefixIndex != NULL) )
+      {  /* The empty name of "--=value" would be a prefix of all. */
+         uint32_t first;
+         uint32_t n = findPrefixRange( pIt->pTable, pCurrent, tl, &first );
+         if( n == 1 )
+            pIt->pBlock = pIt->pTable->ppPrefixIndex[first];
+         else if( n > 1 )
+         {
+            struct OPTION_ERROR_T error =
+            {
+               .code            = OPT_ERR_AMBIGUOUS_LONG_OPTION,
+               .argvIndex       = pIt->argvIndex,
+               .pToken          = pCurrent - 2,
+               .tokenLength     = tl + 2,
+               .ppCandidates    = &pIt->pTable->ppPrefixIndex[first],
+               .numOfCandidates = n
+            };
+            reportError( pIt->pErrorSink, ppAgv[0], &error );
+            return OPT_ITER_UNKNOWN;
+         }
+      }
+   }
+#ifdef HAVE_X86_SIMD
+   else if( pIt->pKeys != NULL )
+   {
+      tl = scanLongOptionName( pCurrent );
+      pIt->pBlock = findLongOptionByKeys( pIt->pKeys, pCurrent, tl );
+   }
+#endif
+   else
+   {
+      while( (pCurrent[tl] != '\0') && (pCurrent[tl] != '=') )
+         tl++;
+      pIt->pBlock = findLongOptionInList( pIt->pOptBlockList, pCurrent, tl );
+   }
+
+   if( pIt->pBlock == NULL )
+   {
+      iteratorError( pIt, OPT_ERR_UNKNOWN_LONG_OPTION, pCurrent - 2,
+                     strlen( pCurrent ) + 2 );
+      return OPT_ITER_UNKNOWN;
+   }
+
+   switch( pIt->pBlock->hasArg )
+   {
+   #ifndef CONFIG_CLOP_NO_NO_ARG
+      case NO_ARG:
+      {
+         break;
+      }
+   #endif /* ifndef CONFIG_CLOP_NO_NO_ARG */
+   #ifndef CONFIG_CLOP_NO_REQUIRED_ARG
+      case REQUIRED_ARG:
+      {
+         if( (pIt->argvIndex+1) == pIt->argc )
+         {
+            iteratorError( pIt, OPT_ERR_MISSING_ARGUMENT, pCurrent - 2, tl + 2 );
+            return OPT_ITER_FATAL;
+         }
+         pIt->argvIndex++;
+         pIt->optArg = ppAgv[pIt->argvIndex];
+         break;
+      }
+   #endif /* ifndef CONFIG_CLOP_NO_REQUIRED_ARG */
+   #ifndef CONFIG_CLOP_NO_OPTIONAL_ARG
+      case OPTIONAL_ARG:
+      {
+         if( pCurrent[tl] == '\0' )
+         {
+            if( ((pIt->argvIndex+1) == pIt->argc) ||
+                (ppAgv[pIt->argvIndex+1][0] != '=') )
+               break; /* No argument */
+
+            pIt->argvIndex++;
+            if( ppAgv[pIt->argvIndex][1] != '\0' )
+            {  /* "--OPTION =ARGUMENT" */
+               pIt->optArg = &ppAgv[pIt->argvIndex][1];
+               break;
+            }
+            if( (pIt->argvIndex+1) == pIt->argc )
+            {
+               iteratorError( pIt, OPT_ERR_MISSING_ARGUMENT_AFTER_EQUAL,
+                              pCurrent - 2, tl + 2 );
+               return OPT_ITER_FATAL;
+            }
+            /* "--OPTION = ARGUMENT" */
+            pIt->argvIndex++;
+            pIt->optArg = ppAgv[pIt->argvIndex];
+            break;
+         } /* if( pCurrent[tl] == '\0' ) */
+         if( pCurrent[tl+1] != '\0' )
+         {  /* "--OPTION=ARGUMENT" */
+            pIt->optArg = &pCurrent[tl+1];
+            break;
+         }
+         if( (pIt->argvIndex+1) == pIt->argc )
+         {
+            iteratorError( pIt, OPT_ERR_MISSING_ARGUMENT_AFTER_EQUAL,
+                           pCurrent - 2, tl + 2 );
+            return OPT_ITER_FATAL;
+         }
+         /* "--OPTION= ARGUMENT" */
+         pIt->argvIndex++;
+         pIt->optArg = ppAgv[pIt->argvIndex];
+         break;
+      } /* End of case OPTIONAL_ARG: */
+   #endif /* ifndef CONFIG_CLOP_NO_OPTIONAL_ARG */
+      default: assert( false ); break; /* Only unvalidated block-lists. */
+   } /* End of switch( pIt->pBlock->hasArg ) */
+
+   return OPT_ITER_FOUND;
+}
+
+/*-----------------------------------------------------------------------------
+ * Short option at pCurrent, possibly within a cluster like "-abc".
+ * Returns the position of the next short option within the cluster
+ * in pIt->pCurrent.
+ */
+static OPT_ITER_RESULT_T nextShortOption( struct OPTION_ITERATOR_T* pIt,
+                                          char* pCurrent )
+{
+   if( pIt->pTable != NULL )
+      pIt->pBlock = pIt->pTable->shortOptIndex[(uint8_t)*pCurrent];
+   else
+      pIt->pBlock = findShortOptionInList( pIt->pOptBlockList, *pCurrent );
+
+   if( pIt->pBlock == NULL )
+   {
+      iteratorError( pIt, OPT_ERR_UNKNOWN_SHORT_OPTION, pCurrent, 1 );
+      pIt->pCurrent = pCurrent + 1;
+      return OPT_ITER_UNKNOWN;
+   }
+
+   switch( pIt->pBlock->hasArg )
+   {
+   #ifndef CONFIG_CLOP_NO_NO_ARG
+      case NO_ARG:
+      {
+         break;
+      }
+   #endif
+   #ifndef CONFIG_CLOP_NO_REQUIRED_ARG
+      case REQUIRED_ARG:
+      {
+         if( (pCurrent[1] == '\0') && ((pIt->argvIndex+1) == pIt->argc) )
+         {
+            iteratorError( pIt, OPT_ERR_MISSING_ARGUMENT, pCurrent, 1 );
+            return OPT_ITER_FATAL;
+         }
+         if( pCurrent[1] != '\0' )
+         {
+            pIt->optArg = &pCurrent[1];
+            do
+               pCurrent++;
+            while( pCurrent[1] != '\0' );
+         }
+         else
+         {
+            pIt->argvIndex++;
+            pIt->optArg = pIt->ppAgv[pIt->argvIndex];
+         }
+         break;
+      }
+   #endif /* ifndef CONFIG_CLOP_NO_REQUIRED_ARG */
+   #ifndef CONFIG_CLOP_NO_OPTIONAL_ARG
+      case OPTIONAL_ARG:
+      {
+         if( pCurrent[1] == '=' )
+         {
+            pCurrent++;
+            if( pCurrent[1] != '\0' )
+               pIt->optArg = &pCurrent[1]; /* "-O=ARGUMENT" */
+            else if( (pIt->argvIndex+1) < pIt->argc )
+            {
+               pIt->argvIndex++; /* "-O= ARGUMENT" */
+               pIt->optArg = pIt->ppAgv[pIt->argvIndex];
+            }
+            else
+            {
+               iteratorError( pIt, OPT_ERR_MISSING_ARGUMENT_AFTER_EQUAL,
+                              pCurrent - 1, 1 );
+               return OPT_ITER_FATAL;
+            }
+         }
+         else if( (pCurrent[1] == '\0') && ((pIt->argvIndex+1) < pIt->argc) )
+         {
+            if( pIt->ppAgv[pIt->argvIndex+1][0] == '=' )
+            {
+               pIt->argvIndex++;
+               if( pIt->ppAgv[pIt->argvIndex][1] != '\0' )
+                  pIt->optArg = &pIt->ppAgv[pIt->argvIndex][1]; /* "-O =ARGUMENT" */
+               else
+               {
+                  if( (pIt->argvIndex+1) < pIt->argc )
+                  {  /* "-O = ARGUMENT" */
+                     pIt->argvIndex++;
+                     pIt->optArg = pIt->ppAgv[pIt->argvIndex];
+                  }
+                  else
+                  {
+                     iteratorError( pIt, OPT_ERR_MISSING_ARGUMENT_AFTER_EQUAL,
+                                    pCurrent, 1 );
+                     return OPT_ITER_FATAL;
+                  }
+               }
+            }
+         }
+
+         if( pIt->optArg == NULL )
+            break;
+
+         while( pCurrent[1] != '\0' )
+            pCurrent++;
+         break;
+      } /* End of case OPTIONAL_ARG */
+   #endif /* ifndef CONFIG_CLOP_NO_OPTIONAL_ARG */
+      default: assert( false ); break; /* Only unvalidated block-lists. */
+   } /* End of switch( pIt->pBlock->hasArg ) */
+
+   pIt->pCurrent = pCurrent + 1;
+   return OPT_ITER_FOUND;
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+OPT_ITER_RESULT_T parseNextOption( struct OPTION_ITERATOR_T* pIt )
+{
+   OPT_ITER_RESULT_T ret;
+   char* pCurrent = pIt->pCurrent;
+
+   pIt->pBlock = NULL;
+   pIt->optArg = NULL;
+
+   if( (pCurrent == NULL) || (*pCurrent == '\0') )
+   {  /* Begin of the next argument. */
+      pIt->pCurrent  = NULL;
+      pIt->argvIndex = pIt->nextIndex;
+      if( pIt->argvIndex >= pIt->limit )
+         return OPT_ITER_END;
+
+      if( pIt->ppAgv[pIt->argvIndex][0] != '-' )
+         return OPT_ITER_END; /* No (further) option present. */
+
+      pCurrent = &pIt->ppAgv[pIt->argvIndex][1];
+      if( *pCurrent == '\0' )
+      {
+         iteratorError( pIt, OPT_ERR_MISSING_OPTION, pCurrent - 1, 1 );
+         return OPT_ITER_FATAL;
+      }
+
+   #ifndef CONFIG_NO_NEGATIVE_NUMBERS_IN_NON_OPTION_ARGUMENTS
+      /* In the case the first non-option argument is a negative number. */
+      if( (*pCurrent >= '0') && (*pCurrent <= '9') )
+         return OPT_ITER_END; /* Argument is not a option but a negative number. */
+   #endif
+
+      if( *pCurrent == '-' ) /* Long option? */
+      {  /* Yes */
+         ret = nextLongOption( pIt, pCurrent );
+         pIt->nextIndex = pIt->argvIndex + 1;
+         return ret;
+      }
+   }
+
+   ret = nextShortOption( pIt, pCurrent );
+   pIt->nextIndex = pIt->argvIndex + 1;
+   return ret;
+}
+
+#ifndef CONFIG_CLOP_FREESTANDING
+/*
+ * Default of OPTION_ARENA_T::chunkSize.
+ */
+#define ARENA_CHUNK_SIZE 4096
+
+#define ARENA_ALIGN( size ) \
+   (((size) + _Alignof( max_align_t ) - 1) & ~(_Alignof( max_align_t ) - 1))
+
+struct OPTION_ARENA_CHUNK_T
+{
+   struct OPTION_ARENA_CHUNK_T* pNext;
+   size_t      size;
+   size_t      used;
+   max_align_t memory[];
+};
+
+/*-----------------------------------------------------------------------------
+ * Memory of size bytes aligned like by malloc(), NULL if exhausted.
+ * An own chunk becomes linked behind the current one, so the rest of the
+ * current chunk remains usable.
+ */
+static void* arenaAllocate( struct OPTION_ARENA_T* pArena, size_t size )
+{
+   struct OPTION_ARENA_CHUNK_T* pChunk = pArena->pChunks;
+   struct OPTION_ARENA_CHUNK_T* pNew;
+   size_t chunkSize = ARENA_ALIGN( (pArena->chunkSize != 0)? pArena->chunkSize :
+                                                             ARENA_CHUNK_SIZE );
+
+   if( size > (SIZE_MAX / 2) )
+      return NULL;
+   size = ARENA_ALIGN( size );
+   if( (pChunk != NULL) && ((pChunk->size - pChunk->used) >= size) )
+   {
+      pChunk->used += size;
+      return (char*)pChunk->memory + pChunk->used - size;
+   }
+
+   if( size > (chunkSize / 4) )
+      chunkSize = size;
+   pNew = malloc( sizeof( struct OPTION_ARENA_CHUNK_T ) + chunkSize );
+   if( pNew == NULL )
+      return NULL;
+   pNew->size = chunkSize;
+   pNew->used = size;
+   if( (pChunk != NULL) && (chunkSize == size) )
+   {
+      pNew->pNext   = pChunk->pNext;
+      pChunk->pNext = pNew;
+   }
+   else
+   {
+      pNew->pNext     = pChunk;
+      pArena->pChunks = pNew;
+   }
+   return pNew->memory;
+}
+
+/*-----------------------------------------------------------------------------
+ * Grows the last allocation p of the current chunk in place if possible.
+ */
+static inline bool arenaExtend( struct OPTION_ARENA_T* pArena, void* p,
+                                size_t oldSize, size_t newSize )
+{
+   struct OPTION_ARENA_CHUNK_T* pChunk = pArena->pChunks;
+
+   oldSize = ARENA_ALIGN( oldSize );
+   newSize = ARENA_ALIGN( newSize );
+   if( (pChunk == NULL) ||
+       ((char*)p + oldSize != (char*)pChunk->memory + pChunk->used) ||
+       ((pChunk->size - pChunk->used) < (newSize - oldSize)) )
+      return false;
+   pChunk->used += newSize - oldSize;
+   return true;
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void* allocateFromOptionArena( struct OPTION_ARENA_T* pArena, size_t size )
+{
+   if( pArena == NULL )
+      return NULL;
+   return arenaAllocate( pArena, size );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void releaseOptionArena( struct OPTION_ARENA_T* pArena )
+{
+   struct OPTION_ARENA_CHUNK_T* pChunk;
+
+   while( (pChunk = pArena->pChunks) != NULL )
+   {
+      pArena->pChunks = pChunk->pNext;
+      free( pChunk );
+   }
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void resetOptionArena( struct OPTION_ARENA_T* pArena )
+{
+   struct OPTION_ARENA_CHUNK_T* pKeep = NULL;
+   struct OPTION_ARENA_CHUNK_T* pChunk;
+
+   while( (pChunk = pArena->pChunks) != NULL )
+   {
+      pArena->pChunks = pChunk->pNext;
+      if( (pKeep == NULL) || (pChunk->size > pKeep->size) )
+      {
+         free( pKeep );
+         pKeep = pChunk;
+      }
+      else
+         free( pChunk );
+   }
+   if( pKeep != NULL )
+   {
+      pKeep->pNext    = NULL;
+      pKeep->used     = 0;
+      pArena->pChunks = pKeep;
+   }
+}
+
+#ifndef CONFIG_CLOP_NO_TYPED_VALUES
+/*
+ * Initial capacity of a list which grows without counting pre-pass.
+ */
+#define LIST_MIN_CAPACITY 8
+
+/*-----------------------------------------------------------------------------
+*/
+static inline bool isListBlock( const struct OPTION_BLOCK_T* pBlock )
+{
+   return (pBlock->optFunction == storeOptionValue) &&
+          (pBlock->valueType == OPT_TYPE_LIST);
+}
+
+/*-----------------------------------------------------------------------------
+ * The value keeps a pointer to the option-argument, so the argument has to
+ * survive the parsing.
+ */
+static inline bool storesArgumentPointer( const struct OPTION_BLOCK_T* pBlock )
+{
+   return (pBlock->optFunction == storeOptionValue) &&
+          ((pBlock->valueType == OPT_TYPE_STRING) ||
+           (pBlock->valueType == OPT_TYPE_LIST));
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static inline struct OPTION_LIST_T* listOf( const struct OPTION_BLOCK_T* pBlock,
+                                            void* pUser )
+{
+   assert( pUser != NULL );
+   return (struct OPTION_LIST_T*)((char*)pUser + pBlock->valueOffset);
+}
+
+/*-----------------------------------------------------------------------------
+ * Item of a occurrence, NULL if nothing has to be appended.
+ */
+static inline const char* listItemOf( const struct OPTION_BLOCK_T* pBlock,
+                                      const char* optArg )
+{
+   return (optArg != NULL)? optArg : pBlock->pValueInfo;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static bool resizeList( struct OPTION_ARENA_T* pArena, struct OPTION_LIST_T* pList,
+                        size_t capacity )
+{
+   const char** ppItems;
+
+   if( (pList->ppItems != NULL) &&
+       arenaExtend( pArena, pList->ppItems, pList->capacity * sizeof( char* ),
+                    capacity * sizeof( char* ) ) )
+   {
+      pList->capacity = capacity;
+      return true;
+   }
+   ppItems = arenaAllocate( pArena, capacity * sizeof( char* ) );
+   if( ppItems == NULL )
+      return false;
+   if( pList->count > 0 )
+      memcpy( ppItems, pList->ppItems, pList->count * sizeof( char* ) );
+   pList->ppItems  = ppItems;
+   pList->capacity = capacity;
+   return true;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void listMemoryError( struct OPTION_CONTEXT_T* pContext,
+                             const char* prgName, int argvIndex,
+                             const struct OPTION_BLOCK_T* pBlock )
+{
+   struct OPTION_ERROR_T error =
+   {
+      .code      = OPT_ERR_OUT_OF_MEMORY,
+      .argvIndex = argvIndex,
+      .pBlock    = pBlock
+   };
+   reportError( (pContext != NULL)? pContext->pErrorSink : NULL, prgName, &error );
+}
+
+/*-----------------------------------------------------------------------------
+ * Store kind OPT_TYPE_LIST of storeOptionValue().
+ */
+static int appendListItem( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   const struct OPTION_BLOCK_T* pBlock = pArg->pCurrentBlock;
+   struct OPTION_LIST_T* pList = listOf( pBlock, pArg->pUser );
+   struct OPTION_ARENA_T* pArena = pArg->pArena;
+   const char* pItem = listItemOf( pBlock, pArg->optArg );
+
+   if( pItem == NULL )
+      return 0;
+   if( (pList->count == pList->capacity) &&
+       ((pArena == NULL) ||
+        !resizeList( pArena, pList, (pList->capacity == 0)? LIST_MIN_CAPACITY :
+                                                            2 * pList->capacity )) )
+   {
+      listMemoryError( pArg->pContext, pArg->ppAgv[0], pArg->argvIndex, pBlock );
+      return -1;
+   }
+   pList->ppItems[pList->count++] = pItem;
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ * Counting pre-pass of OPTION_CONTEXT_T::countLists: counts the occurrences
+ * of each OPT_TYPE_LIST option by the iterator without callbacks and
+ * allocates the arrays of the lists once. The errors of the command line
+ * becomes reported by the following parsing.
+ */
+static int reserveOptionLists( int offset, int argc, char* const ppAgv[],
+                               struct OPTION_CONTEXT_T* pContext,
+                               struct OPTION_KEYS_T* pKeys )
+{
+   const struct OPTION_TABLE_T* pTable = pContext->pTable;
+   struct OPTION_BLOCK_T* optBlockList = (pTable != NULL)? pTable->pOptBlockList :
+                                                           pContext->pOptBlockList;
+   struct OPTION_ERROR_SINK_T silentSink = { .pErrors = NULL };
+   struct OPTION_ITERATOR_T it;
+   OPT_ITER_RESULT_T result;
+   BLK_LIST_ITERATOR_T pBlock;
+   struct OPTION_LIST_T* pList;
+   bool hasLists = false;
+
+   FOR_EACH_OPTION_BLOCK( pBlock, optBlockList )
+   {
+      if( !isListBlock( pBlock ) )
+         continue;
+      pList = listOf( pBlock, pContext->pUser );
+      pList->needed = pList->count;
+      hasLists = true;
+   }
+   if( !hasLists )
+      return 0;
+
+   initIterator( &it, offset, argc, ppAgv, optBlockList, pTable );
+   it.pErrorSink = &silentSink;
+   it.pKeys      = pKeys;
+   while( ((result = parseNextOption( &it )) != OPT_ITER_END) &&
+          (result != OPT_ITER_FATAL) )
+   {
+      if( (result == OPT_ITER_FOUND) && isListBlock( it.pBlock ) &&
+          (listItemOf( it.pBlock, it.optArg ) != NULL) )
+         listOf( it.pBlock, pContext->pUser )->needed++;
+   }
+
+   FOR_EACH_OPTION_BLOCK( pBlock, optBlockList )
+   {
+      if( !isListBlock( pBlock ) )
+         continue;
+      pList = listOf( pBlock, pContext->pUser );
+      if( (pList->needed > pList->capacity) &&
+          !resizeList( pContext->pArena, pList, pList->needed ) )
+      {
+         listMemoryError( pContext, ppAgv[0], offset, pBlock );
+         return -1;
+      }
+   }
+   return 0;
+}
+#endif /* ifndef CONFIG_CLOP_NO_TYPED_VALUES */
+#endif /* ifndef CONFIG_CLOP_FREESTANDING */
+
+#ifndef CONFIG_CLOP_NO_TYPED_VALUES
+/*-----------------------------------------------------------------------------
+ * Applies the store kinds which need no conversion.
+ * Returns false if the type needs a conversion.
+ */
+static inline bool storeSimpleValue( const struct OPTION_BLOCK_T* pBlock,
+                                     const char* optArg, void* pUser )
+{
+   void* pValue;
+
+   if( (pBlock->valueType < OPT_TYPE_SET_BIT) ||
+       (pBlock->valueType > OPT_TYPE_COUNTER) )
+      return false;
+
+   assert( pUser != NULL );
+   pValue = (char*)pUser + pBlock->valueOffset;
+   switch( pBlock->valueType )
+   {
+      case OPT_TYPE_SET_BIT:
+      {  /* Block-lists without table are not validated. */
+         assert( (unsigned int)pBlock->id < (sizeof( unsigned int ) * 8) );
+         *(unsigned int*)pValue |= (1U << pBlock->id);
+         break;
+      }
+      case OPT_TYPE_SET_TRUE:
+      {
+         *(bool*)pValue = true;
+         break;
+      }
+      case OPT_TYPE_SET_FALSE:
+      {
+         *(bool*)pValue = false;
+         break;
+      }
+      case OPT_TYPE_STRING:
+      {
+         *(const char**)pValue = (optArg != NULL)? optArg : pBlock->pValueInfo;
+         break;
+      }
+      case OPT_TYPE_COUNTER:
+      {
+         (*(int*)pValue)++;
+         break;
+      }
+      default: /* Excluded by validateOptionBlockList(). */
+      {
+         break;
+      }
+   }
+   return true;
+}
+#endif /* ifndef CONFIG_CLOP_NO_TYPED_VALUES */
+
+#ifdef CONFIG_CLOP_STATISTICS
+/*
+ * The counters are statistics only, so no ordering between the threads
+ * is required: a relaxed atomic operation without lock is sufficient.
+ */
+#define STATISTICS_ADD( counter, value ) \
+   __atomic_fetch_add( &(counter), (value), __ATOMIC_RELAXED )
+
+/*
+ * Statistics object of the parse contexts without own one.
+ * @see setOptionStatistics
+ */
+static struct OPTION_STATISTICS_T* g_pStatistics = NULL;
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void initOptionStatistics( struct OPTION_STATISTICS_T* pStatistics,
+                           struct OPTION_BLOCK_STATISTIC_T pBlocks[],
+                           struct OPTION_BLOCK_T optBlockList[] )
+{
+   BLK_LIST_ITERATOR_T pBlock;
+   size_t n = 0;
+
+   FOR_EACH_OPTION_BLOCK( pBlock, optBlockList )
+   {
+      pBlocks[n].hits        = 0;
+      pBlocks[n].nanoseconds = 0;
+      n++;
+   }
+   pStatistics->pOptBlockList     = optBlockList;
+   pStatistics->pBlocks           = pBlocks;
+   pStatistics->numOfBlocks       = n;
+   pStatistics->getNanoseconds    = NULL;
+   pStatistics->parses            = 0;
+   pStatistics->lookups           = 0;
+   pStatistics->unknown           = 0;
+   pStatistics->lookupNanoseconds = 0;
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void setOptionStatistics( struct OPTION_STATISTICS_T* pStatistics )
+{
+   __atomic_store_n( &g_pStatistics, pStatistics, __ATOMIC_RELAXED );
+}
+
+/*-----------------------------------------------------------------------------
+ * Monotonic time in nanoseconds.
+ */
+static inline uint64_t statisticsClock( const struct OPTION_STATISTICS_T* pStatistics )
+{
+   if( pStatistics == NULL )
+      return 0;
+   if( pStatistics->getNanoseconds != NULL )
+      return pStatistics->getNanoseconds();
+#ifdef HAVE_MONOTONIC_CLOCK
+   return monotonicNanoseconds();
+#else
+   return 0;
+#endif
+}
+
+/*-----------------------------------------------------------------------------
+ * Records a lookup of parseNextOption() which has been started at the time
+ * start, returns the current time.
+ */
+static inline uint64_t recordLookup( struct OPTION_STATISTICS_T* pStatistics,
+                                     OPT_ITER_RESULT_T result, uint64_t start )
+{
+   uint64_t now;
+
+   if( pStatistics == NULL )
+      return 0;
+   now = statisticsClock( pStatistics );
+   if( result == OPT_ITER_END )
+      return now;
+   STATISTICS_ADD( pStatistics->lookups, 1 );
+   if( result == OPT_ITER_UNKNOWN )
+      STATISTICS_ADD( pStatistics->unknown, 1 );
+   STATISTICS_ADD( pStatistics->lookupNanoseconds, now - start );
+   return now;
+}
+
+/*-----------------------------------------------------------------------------
+ * Records the handling of the option pBlock which has been started at the
+ * time start, returns the current time.
+ */
+static inline uint64_t recordHit( struct OPTION_STATISTICS_T* pStatistics,
+                                  const struct OPTION_BLOCK_T* pBlock,
+                                  uint64_t start )
+{
+   struct OPTION_BLOCK_STATISTIC_T* pBlockStatistic;
+   uint64_t now;
+   size_t i;
+
+   if( pStatistics == NULL )
+      return 0;
+   now = statisticsClock( pStatistics );
+   /* Blocks of a other block-list are out of range. */
+   i = ((uintptr_t)pBlock - (uintptr_t)pStatistics->pOptBlockList) /
+       sizeof( struct OPTION_BLOCK_T );
+   if( i < pStatistics->numOfBlocks )
+   {
+      pBlockStatistic = &pStatistics->pBlocks[i];
+      STATISTICS_ADD( pBlockStatistic->hits, 1 );
+      STATISTICS_ADD( pBlockStatistic->nanoseconds, now - start );
+   }
+   return now;
+}
+#endif /* ifdef CONFIG_CLOP_STATISTICS */
+
+/*
+ * Parses the arguments beginning at offset until the first non-option
+ * argument, the end of the vector or until the index limit has been
+ * reached. Errors which doesn't terminate the parsing becomes reported in
+ * *pError. The long options becomes matched by the packed keys pKeys if
+ * not NULL.
+ */
+static int parseCommandLine( int offset,
+                             int limit,
+                             int argc,
+                             char* const ppAgv[],
+                             struct OPTION_CONTEXT_T* pContext,
+                             struct OPTION_KEYS_T* pKeys,
+                             bool* pError
+                           )
+{
+   const struct OPTION_TABLE_T* pTable = pContext->pTable;
+   void* pUser = pContext->pUser;
+   struct BLOCK_FUNCTION_ARG_T arg =
+   {
+      .argc          = argc,
+      .ppAgv         = ppAgv,
+      .pOptBlockList = (pTable != NULL)? pTable->pOptBlockList :
+                                         pContext->pOptBlockList,
+      .pOptTable     = pTable,
+      .pContext      = pContext,
+      .pUser         = pUser,
+#ifndef CONFIG_CLOP_FREESTANDING
+      .pArena        = pContext->pArena
+#endif
+   };
+   struct OPTION_ITERATOR_T it;
+   OPT_ITER_RESULT_T result;
+   int ret;
+#ifdef CONFIG_CLOP_STATISTICS
+   struct OPTION_STATISTICS_T* pStatistics =
+      (pContext->pStatistics != NULL)? pContext->pStatistics :
+                                       __atomic_load_n( &g_pStatistics,
+                                                        __ATOMIC_RELAXED );
+   uint64_t time = statisticsClock( pStatistics );
+
+   if( pStatistics != NULL )
+      STATISTICS_ADD( pStatistics->parses, 1 );
+#endif
+
+   initIterator( &it, offset, argc, ppAgv, arg.pOptBlockList, pTable );
+   it.limit      = limit;
+   it.pErrorSink = pContext->pErrorSink;
+   it.pKeys      = pKeys;
+
+   while( true )
+   {
+      result = parseNextOption( &it );
+   #ifdef CONFIG_CLOP_STATISTICS
+      time = recordLookup( pStatistics, result, time );
+   #endif
+      switch( result )
+      {
+         case OPT_ITER_FOUND:
+         {
+            arg.argvIndex     = it.argvIndex;
+            arg.optArg        = it.optArg;
+            arg.pCurrentBlock = it.pBlock;
+            if( pContext->preHook != NULL )
+               pContext->preHook( &arg );
+         #ifndef CONFIG_CLOP_NO_TYPED_VALUES
+            if( (it.pBlock->optFunction == storeOptionValue) &&
+                storeSimpleValue( it.pBlock, it.optArg, pUser ) )
+               ret = 0; /* Stored inline without callback. */
+            else
+         #endif
+               ret = it.pBlock->optFunction( &arg );
+         #ifdef CONFIG_CLOP_STATISTICS
+            time = recordHit( pStatistics, it.pBlock, time );
+         #endif
+            if( pContext->postHook != NULL )
+               pContext->postHook( &arg, ret );
+            if( ret < 0 )
+               return ret;
+            if( ret > 0 )
+               *pError = true;
+            if( arg.argvIndex != it.argvIndex )
+            {  /* The callback function has been skipped some arguments. */
+               it.argvIndex = arg.argvIndex;
+               it.nextIndex = arg.argvIndex + 1;
+            }
+            break;
+         }
+         case OPT_ITER_UNKNOWN:
+         {
+            *pError = true;
+            break;
+         }
+         case OPT_ITER_END:
+         {
+            return it.argvIndex;
+         }
+         default:
+         {
+            return -1;
+         }
+      }
+   }
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int parseCommandLineOptionsAt( int offset,
+                               int argc,
+                               char* const ppAgv[],
+                               struct OPTION_BLOCK_T optBlockList[],
+                               void* pUser
+                             )
+{
+   struct OPTION_CONTEXT_T context =
+   {
+      .pOptBlockList = optBlockList,
+      .pUser         = pUser
+   };
+   return parseCommandLineContextAt( offset, argc, ppAgv, &context );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int parseCommandLineOptionsTableAt( int offset,
+                                    int argc,
+                                    char* const ppAgv[],
+                                    const struct OPTION_TABLE_T* pTable,
+                                    void* pUser
+                                  )
+{
+   struct OPTION_CONTEXT_T context =
+   {
+      .pTable = pTable,
+      .pUser  = pUser
+   };
+   assert( pTable != NULL );
+   return parseCommandLineContextAt( offset, argc, ppAgv, &context );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int parseCommandLineContextAt( int offset,
+                               int argc,
+                               char* const ppAgv[],
+                               struct OPTION_CONTEXT_T* pContext
+                             )
+{
+   bool error = false;
+   int ret;
+   struct OPTION_KEYS_T* pKeys = NULL;
+#ifdef HAVE_X86_SIMD
+   struct OPTION_KEYS_T keys;
+#endif
+
+   assert( (pContext->pTable != NULL) || (pContext->pOptBlockList != NULL) );
+#ifdef HAVE_X86_SIMD
+   pKeys = prepareKeys( &keys, pContext );
+#endif
+#if !defined( CONFIG_CLOP_FREESTANDING ) && !defined( CONFIG_CLOP_NO_TYPED_VALUES )
+   if( pContext->countLists && (pContext->pArena != NULL) &&
+       (reserveOptionLists( offset, argc, ppAgv, pContext, pKeys ) < 0) )
+      ret = -1;
+   else
+#endif
+      ret = parseCommandLine( offset, argc, argc, ppAgv, pContext, pKeys, &error );
+#ifdef HAVE_X86_SIMD
+   releaseKeys( pKeys );
+#endif
+   return (error && (ret >= 0))? -1 : ret;
+}
+
+/*-----------------------------------------------------------------------------
+ * Block-list of the subcommands without options, so a option becomes
+ * reported as unrecognized and not taken as name of a subcommand.
+ */
+static struct OPTION_BLOCK_T g_noSubcommandOptions[] =
+{
+   OPTION_BLOCKLIST_END_MARKER
+};
+
+#ifndef CONFIG_CLOP_FREESTANDING
+/*-----------------------------------------------------------------------------
+ * Returns the option table of the subcommand, compiled by the first
+ * invocation. Concurrent first invocations compiles it more than once, the
+ * first published table wins. NULL when not enough memory.
+ * The findings of the compiling becomes reported in pSink.
+ */
+static const struct OPTION_TABLE_T*
+subcommandTable( struct OPTION_SUBCOMMAND_T* pSubcommand,
+                 struct OPTION_ERROR_SINK_T* pSink )
+{
+   struct OPTION_TABLE_T* pTable;
+   struct OPTION_TABLE_T* pPublished = NULL;
+
+   pTable = __atomic_load_n( &pSubcommand->pTable, __ATOMIC_ACQUIRE );
+   if( pTable != NULL )
+      return pTable;
+
+   pTable = malloc( sizeof( struct OPTION_TABLE_T ) );
+   if( pTable == NULL )
+      return NULL;
+   if( initOptionTableWithSink( pTable, pSubcommand->pOptBlockList,
+                                pSink ) < 0 )
+   {
+      free( pTable );
+      return NULL;
+   }
+   if( !__atomic_compare_exchange_n( &pSubcommand->pTable, &pPublished, pTable,
+                                     false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ) )
+   {  /* A other thread has been faster. */
+      freeOptionTable( pTable );
+      free( pTable );
+      pTable = pPublished;
+   }
+   return pTable;
+}
+#endif /* ifndef CONFIG_CLOP_FREESTANDING */
+
+#ifndef CONFIG_CLOP_NO_DLOPEN
+/*-----------------------------------------------------------------------------
+ * Returns the subcommand object of the plugin, the shared object becomes
+ * loaded by the first invocation. Concurrent first invocations are loading
+ * it more than once, that counts up the reference of the dynamic linker
+ * only. NULL when the plugin can't be loaded, the error is reported then.
+ */
+static struct OPTION_SUBCOMMAND_T*
+loadSubcommandPlugin( struct OPTION_SUBCOMMAND_T* pSubcommand,
+                      char* const ppAgv[], int index,
+                      struct OPTION_ERROR_SINK_T* pErrorSink )
+{
+   struct OPTION_SUBCOMMAND_T* pPlugin;
+   void* pHandle;
+   void* pPublished = NULL;
+
+   pPlugin = __atomic_load_n( &pSubcommand->pPlugin, __ATOMIC_ACQUIRE );
+   if( pPlugin != NULL )
+      return pPlugin;
+
+   struct OPTION_ERROR_T error =
+   {
+      .code      = OPT_ERR_PLUGIN_NOT_LOADABLE,
+      .argvIndex = index,
+      .pToken    = pSubcommand->pluginPath
+   };
+   assert( pSubcommand->pluginSymbol != NULL );
+   pHandle = dlopen( pSubcommand->pluginPath, RTLD_NOW | RTLD_LOCAL );
+   if( pHandle != NULL )
+   {
+      pPlugin = dlsym( pHandle, pSubcommand->pluginSymbol );
+      if( pPlugin != NULL )
+      {
+         if( __atomic_compare_exchange_n( &pSubcommand->pPluginHandle,
+                                          &pPublished, pHandle, false,
+                                          __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ) )
+            __atomic_store_n( &pSubcommand->pPlugin, pPlugin, __ATOMIC_RELEASE );
+         else /* A other thread has been faster, its handle keeps it loaded. */
+            dlclose( pHandle );
+         return pPlugin;
+      }
+      dlclose( pHandle );
+      error.code   = OPT_ERR_PLUGIN_SYMBOL_NOT_FOUND;
+      error.pToken = pSubcommand->pluginSymbol;
+   }
+   error.tokenLength = strlen( error.pToken );
+   reportError( pErrorSink, ppAgv[0], &error );
+   return NULL;
+}
+#endif /* ifndef CONFIG_CLOP_NO_DLOPEN */
+
+/*-----------------------------------------------------------------------------
+*/
+static struct OPTION_SUBCOMMAND_T*
+findSubcommand( struct OPTION_SUBCOMMAND_T* pParent, const char* name )
+{
+   struct OPTION_SUBCOMMAND_T* pSubcommand;
+
+   for( pSubcommand = pParent->pSubcommands; pSubcommand->name != NULL; pSubcommand++ )
+   {
+      if( strcmp( pSubcommand->name, name ) == 0 )
+         return pSubcommand;
+   }
+   return NULL;
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int parseSubcommandLine( int argc,
+                         char* const ppAgv[],
+                         struct OPTION_SUBCOMMAND_T* pRoot,
+                         struct OPTION_CONTEXT_T* pContext
+                       )
+{
+   struct OPTION_CONTEXT_T context = { .pOptBlockList = NULL };
+   struct OPTION_SUBCOMMAND_T* pNode = pRoot;
+   struct OPTION_SUBCOMMAND_T* pNext;
+   int index = 1;
+
+   assert( pRoot != NULL );
+   if( pContext != NULL )
+      context = *pContext;
+
+   while( true )
+   {
+      context.pTable = NULL;
+      if( pNode->pOptBlockList != NULL )
+      {
+         context.pOptBlockList = pNode->pOptBlockList;
+      #ifndef CONFIG_CLOP_FREESTANDING
+         context.pTable = subcommandTable( pNode, context.pErrorSink );
+      #endif
+      }
+      else
+      {
+         context.pOptBlockList = g_noSubcommandOptions;
+      }
+
+      index = parseCommandLineContextAt( index, argc, ppAgv, &context );
+      if( (index < 0) || (pNode->pSubcommands == NULL) )
+         break;
+
+      pNext = (index < argc)? findSubcommand( pNode, ppAgv[index] ) : NULL;
+      if( pNext == NULL )
+      {
+         if( pNode->function != NULL )
+            break;
+         struct OPTION_ERROR_T error =
+         {
+            .code      = (index < argc)? OPT_ERR_UNKNOWN_SUBCOMMAND :
+                                         OPT_ERR_MISSING_SUBCOMMAND,
+            .argvIndex = index
+         };
+         if( index < argc )
+         {
+            error.pToken      = ppAgv[index];
+            error.tokenLength = strlen( ppAgv[index] );
+         }
+         reportError( context.pErrorSink, ppAgv[0], &error );
+         return -1;
+      }
+      pNode = pNext;
+   #ifndef CONFIG_CLOP_NO_DLOPEN
+      if( pNode->pluginPath != NULL )
+      {
+         pNode = loadSubcommandPlugin( pNode, ppAgv, index, context.pErrorSink );
+         if( pNode == NULL )
+            return -1;
+      }
+   #endif
+      index++;
+   }
+
+   if( (index < 0) || (pNode->function == NULL) )
+      return index;
+
+   struct SUBCOMMAND_FUNCTION_ARG_T arg =
+   {
+      .argc        = argc,
+      .ppAgv       = ppAgv,
+      .argvIndex   = index,
+      .pSubcommand = pNode,
+      .pContext    = &context,
+      .pUser       = context.pUser
+   };
+   return pNode->function( &arg );
+}
+
+#ifndef CONFIG_CLOP_FREESTANDING
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void freeSubcommandTables( struct OPTION_SUBCOMMAND_T* pRoot )
+{
+   struct OPTION_SUBCOMMAND_T* pSubcommand;
+
+   if( pRoot->pTable != NULL )
+   {
+      freeOptionTable( pRoot->pTable );
+      free( pRoot->pTable );
+      pRoot->pTable = NULL;
+   }
+#ifndef CONFIG_CLOP_NO_DLOPEN
+   if( pRoot->pPlugin != NULL )
+   {  /* The tables of the plugin before its memory disappears. */
+      freeSubcommandTables( pRoot->pPlugin );
+      dlclose( pRoot->pPluginHandle );
+      pRoot->pPlugin       = NULL;
+      pRoot->pPluginHandle = NULL;
+   }
+#endif
+   if( pRoot->pSubcommands == NULL )
+      return;
+   for( pSubcommand = pRoot->pSubcommands; pSubcommand->name != NULL; pSubcommand++ )
+      freeSubcommandTables( pSubcommand );
+}
+#endif /* ifndef CONFIG_CLOP_FREESTANDING */
+
+#ifndef CONFIG_CLOP_NO_TYPED_VALUES
+/*
+ * Maximum number of significant decimal digits which becomes forwarded
+ * to strtod() when the fast path of readDouble() isn't possible.
+ * The exact decimal representation of each double has less digits.
+ */
+#define MAX_DOUBLE_DIGITS 780
+
+typedef enum
+{
+   CONV_OK,
+   CONV_SYNTAX,
+   CONV_RANGE
+} CONV_RESULT_T;
+
+/*-----------------------------------------------------------------------------
+ * Returns the value of a hexadecimal digit or 16 if it's not a digit.
+ */
+static inline unsigned int hexDigit( char c )
+{
+   unsigned int d = (unsigned int)(c - '0');
+
+   if( d < 10 )
+      return d;
+   d = (unsigned int)((c | 0x20) - 'a');
+   if( d < 6 )
+      return d + 10;
+   return 16;
+}
+
+/*-----------------------------------------------------------------------------
+ * Reads a decimal or "0x..." hexadecimal unsigned integer number and moves
+ * *ppStr behind its last digit. The whole number becomes read even
+ * by a overflow.
+ */
+static CONV_RESULT_T readUnsigned( const char** ppStr, uint64_t* pValue )
+{
+   const char* pC = *ppStr;
+   CONV_RESULT_T ret = CONV_OK;
+   uint64_t value = 0;
+   unsigned int digit;
+
+   if( (pC[0] == '0') && ((pC[1] | 0x20) == 'x') )
+   {
+      pC += 2;
+      if( hexDigit( *pC ) == 16 )
+         return CONV_SYNTAX;
+      while( (digit = hexDigit( *pC )) < 16 )
+      {
+         if( value > (UINT64_MAX >> 4) )
+            ret = CONV_RANGE;
+         value = (value << 4) | digit;
+         pC++;
+      }
+   }
+   else
+   {
+      if( (unsigned int)(*pC - '0') >= 10 )
+         return CONV_SYNTAX;
+      while( (digit = (unsigned int)(*pC - '0')) < 10 )
+      {
+         if( value > ((UINT64_MAX - digit) / 10) )
+            ret = CONV_RANGE;
+         value = value * 10 + digit;
+         pC++;
+      }
+   }
+   *ppStr  = pC;
+   *pValue = value;
+   return ret;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static CONV_RESULT_T readSigned( const char* pStr, int64_t* pValue )
+{
+   CONV_RESULT_T ret;
+   uint64_t magnitude;
+   bool negative = (*pStr == '-');
+
+   if( (*pStr == '-') || (*pStr == '+') )
+      pStr++;
+   ret = readUnsigned( &pStr, &magnitude );
+   if( ret == CONV_SYNTAX )
+      return ret;
+   if( *pStr != '\0' )
+      return CONV_SYNTAX;
+   if( ret != CONV_OK )
+      return ret;
+   if( magnitude > ((uint64_t)INT64_MAX + negative) )
+      return CONV_RANGE;
+   *pValue = negative? (int64_t)(0 - magnitude) : (int64_t)magnitude;
+   return CONV_OK;
+}
+
+#ifdef CONFIG_CLOP_FREESTANDING
+/*-----------------------------------------------------------------------------
+ * Replacement of strtod() for the slow path of readDouble(): the digits
+ * becomes scaled by multiplications with powers of ten. The result is not
+ * correctly rounded, the error can be some units in the last place.
+ */
+static double scaleDecimal( const char* pDigits, int exponent )
+{
+   double value = 0.0;
+   double power = 10.0;
+   bool negative;
+   unsigned int n;
+
+   for( ; (unsigned int)(*pDigits - '0') < 10; pDigits++ )
+   {
+      if( value < 1e300 )
+         value = value * 10.0 + (*pDigits - '0');
+      else
+         exponent++;
+   }
+   negative = (exponent < 0);
+   for( n = negative? -exponent : exponent; n != 0; n >>= 1 )
+   {
+      if( (n & 1) != 0 )
+         value = negative? value / power : value * power;
+      power *= power;
+   }
+   return value;
+}
+#endif
+
+/*-----------------------------------------------------------------------------
+ * Reads a floating point number always with '.' as decimal point.
+ * Numbers with up to 19 significant digits and a small exponent becomes
+ * converted exactly by one multiplication or division, all other numbers
+ * becomes forwarded to strtod() as digits and exponent only, so the
+ * locale has no influence.
+ */
+static CONV_RESULT_T readDouble( const char* pStr, double* pValue )
+{
+   static const double powerOfTen[] =
+   {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+   };
+   const char* pC = pStr;
+   const char* pDigits;
+   bool negative = false;
+   bool anyDigit = false;
+   uint64_t mantissa = 0;
+   int numOfDigits = 0;  /* Significant digits */
+   int exponent = 0;
+   int e = 0;
+   int explicitExponent = 0;
+   bool eNegative;
+   unsigned int digit;
+   double value;
+
+   if( (*pC == '-') || (*pC == '+') )
+   {
+      negative = (*pC == '-');
+      pC++;
+   }
+   pDigits = pC;
+   while( (digit = (unsigned int)(*pC - '0')) < 10 )
+   {
+      anyDigit = true;
+      if( (mantissa != 0) || (digit != 0) )
+         numOfDigits++;
+      if( numOfDigits <= 19 )
+         mantissa = mantissa * 10 + digit;
+      else
+         exponent++;
+      pC++;
+   }
+   if( *pC == '.' )
+   {
+      pC++;
+      while( (digit = (unsigned int)(*pC - '0')) < 10 )
+      {
+         anyDigit = true;
+         if( (mantissa != 0) || (digit != 0) )
+            numOfDigits++;
+         if( numOfDigits <= 19 )
+         {
+            mantissa = mantissa * 10 + digit;
+            exponent--;
+         }
+         pC++;
+      }
+   }
+   if( !anyDigit )
+      return CONV_SYNTAX;
+   if( (*pC | 0x20) == 'e' )
+   {
+      pC++;
+      eNegative = (*pC == '-');
+      if( (*pC == '-') || (*pC == '+') )
+         pC++;
+      if( (unsigned int)(*pC - '0') >= 10 )
+         return CONV_SYNTAX;
+      while( (digit = (unsigned int)(*pC - '0')) < 10 )
+      {
+         if( e < 100000 ) /* Saturation, it's far outside of double anyway. */
+            e = e * 10 + digit;
+         pC++;
+      }
+      explicitExponent = eNegative? -e : e;
+      exponent += explicitExponent;
+   }
+   if( *pC != '\0' )
+      return CONV_SYNTAX;
+
+   if( (numOfDigits <= 19) && (mantissa <= (1ULL << 53)) &&
+       (exponent >= -22) && (exponent <= 22) )
+   {  /* Fast path: mantissa and power of ten are exact, so is the result. */
+      value = (double)mantissa;
+      if( exponent < 0 )
+         value /= powerOfTen[-exponent];
+      else
+         value *= powerOfTen[exponent];
+   }
+   else
+   {  /* Slow path: significant digits without decimal point. */
+      char buffer[MAX_DOUBLE_DIGITS + 16];
+      size_t n = 0;
+      bool inFraction = false;
+
+      exponent = explicitExponent;
+      for( pC = pDigits; ((unsigned int)(*pC - '0') < 10) || (*pC == '.'); pC++ )
+      {
+         if( *pC == '.' )
+         {
+            inFraction = true;
+            continue;
+         }
+         if( (n == 0) && (*pC == '0') )
+         {  /* Leading zero */
+            if( inFraction )
+               exponent--;
+            continue;
+         }
+         if( n < MAX_DOUBLE_DIGITS )
+         {
+            buffer[n++] = *pC;
+            if( inFraction )
+               exponent--;
+         }
+         else if( !inFraction )
+            exponent++;
+      }
+      if( n == 0 )
+         buffer[n++] = '0';
+      buffer[n++] = 'e';
+      if( exponent < 0 )
+         buffer[n++] = '-';
+      n += formatUnsigned( &buffer[n], (exponent < 0)? -exponent : exponent );
+      buffer[n] = '\0';
+   #ifndef CONFIG_CLOP_FREESTANDING
+      value = strtod( buffer, NULL );
+   #else
+      value = scaleDecimal( buffer, exponent );
+   #endif
+   }
+
+   if( (value > DBL_MAX) || (value < -DBL_MAX) )
+      return CONV_RANGE;
+   *pValue = negative? -value : value;
+   return CONV_OK;
+}
+
+/*-----------------------------------------------------------------------------
+ * Unsigned number with optional binary suffix, e.g. "4K", "64MiB", "1GB".
+ */
+static CONV_RESULT_T readSize( const char* pStr, uint64_t* pValue )
+{
+   static const char suffixes[] = "kmgtpe";
+   const char* pSuffix;
+   unsigned int shift = 0;
+   CONV_RESULT_T ret;
+
+   ret = readUnsigned( &pStr, pValue );
+   if( ret == CONV_SYNTAX )
+      return ret;
+   if( (*pStr != '\0') && ((pSuffix = strchr( suffixes, *pStr | 0x20 )) != NULL) )
+   {
+      shift = (unsigned int)(pSuffix - suffixes + 1) * 10;
+      pStr++;
+      if( (*pStr | 0x20) == 'i' )
+      {
+         pStr++;
+         if( (*pStr | 0x20) != 'b' )
+            return CONV_SYNTAX;
+      }
+   }
+   if( (*pStr | 0x20) == 'b' )
+      pStr++;
+   if( *pStr != '\0' )
+      return CONV_SYNTAX;
+   if( ret != CONV_OK )
+      return ret;
+   if( *pValue > (UINT64_MAX >> shift) )
+      return CONV_RANGE;
+   *pValue <<= shift;
+   return CONV_OK;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static CONV_RESULT_T readBool( const char* pStr, bool* pValue )
+{
+   static const char* const names[] =
+   {  /* Even index true, odd index false. */
+      "1", "0", "true", "false", "yes", "no", "on", "off"
+   };
+   unsigned int i;
+
+   for( i = 0; i < (sizeof( names ) / sizeof( names[0] )); i++ )
+   {
+      if( strcmp( pStr, names[i] ) == 0 )
+      {
+         *pValue = ((i & 1) == 0);
+         return CONV_OK;
+      }
+   }
+   return CONV_SYNTAX;
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int storeOptionValue( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   const struct OPTION_BLOCK_T* pBlock = pArg->pCurrentBlock;
+   const struct OPTION_RANGE_T* pRange = pBlock->pValueInfo;
+   void* pValue;
+   CONV_RESULT_T result = CONV_OK;
+   const char* pC;
+   const char* const* ppName;
+   int64_t  i;
+   uint64_t u;
+   double   d;
+   bool     b;
+
+   if( storeSimpleValue( pBlock, pArg->optArg, pArg->pUser ) )
+      return 0;
+#ifndef CONFIG_CLOP_FREESTANDING
+   if( pBlock->valueType == OPT_TYPE_LIST )
+      return appendListItem( pArg );
+#endif
+
+   assert( pArg->pUser != NULL );
+   pValue = (char*)pArg->pUser + pBlock->valueOffset;
+
+   if( pArg->optArg == NULL )
+   {  /* No argument given. */
+      if( pBlock->valueType == OPT_TYPE_BOOL )
+         *(bool*)pValue = true;
+      return 0;
+   }
+
+   switch( pBlock->valueType )
+   {
+      case OPT_TYPE_INT32:
+      case OPT_TYPE_INT64:
+      {
+         result = readSigned( pArg->optArg, &i );
+         if( result != CONV_OK )
+            break;
+         if( (pRange != NULL) && ((i < pRange->min.i) || (i > pRange->max.i)) )
+         {
+            result = CONV_RANGE;
+            break;
+         }
+         if( pBlock->valueType == OPT_TYPE_INT64 )
+         {
+            *(int64_t*)pValue = i;
+            break;
+         }
+         if( (i < INT32_MIN) || (i > INT32_MAX) )
+         {
+            result = CONV_RANGE;
+            break;
+         }
+         *(int32_t*)pValue = (int32_t)i;
+         break;
+      }
+      case OPT_TYPE_UINT64:
+      case OPT_TYPE_SIZE:
+      {
+         pC = pArg->optArg;
+         if( pBlock->valueType == OPT_TYPE_SIZE )
+            result = readSize( pC, &u );
+         else if( (result = readUnsigned( &pC, &u )) != CONV_SYNTAX && (*pC != '\0') )
+            result = CONV_SYNTAX;
+         if( result != CONV_OK )
+            break;
+         if( (pRange != NULL) && ((u < pRange->min.u) || (u > pRange->max.u)) )
+         {
+            result = CONV_RANGE;
+            break;
+         }
+         *(uint64_t*)pValue = u;
+         break;
+      }
+      case OPT_TYPE_DOUBLE:
+      {
+         result = readDouble( pArg->optArg, &d );
+         if( result != CONV_OK )
+            break;
+         if( (pRange != NULL) && ((d < pRange->min.d) || (d > pRange->max.d)) )
+         {
+            result = CONV_RANGE;
+            break;
+         }
+         *(double*)pValue = d;
+         break;
+      }
+      case OPT_TYPE_BOOL:
+      {
+         result = readBool( pArg->optArg, &b );
+         if( result == CONV_OK )
+            *(bool*)pValue = b;
+         break;
+      }
+      case OPT_TYPE_ENUM:
+      {
+         assert( pBlock->pValueInfo != NULL );
+         result = CONV_SYNTAX;
+         for( ppName = pBlock->pValueInfo; *ppName != NULL; ppName++ )
+         {
+            if( strcmp( pArg->optArg, *ppName ) == 0 )
+            {
+               *(int*)pValue = (int)(ppName - (const char* const*)pBlock->pValueInfo);
+               result = CONV_OK;
+               break;
+            }
+         }
+         break;
+      }
+      default: /* Excluded by validateOptionBlockList(). */
+      {
+         return -1;
+      }
+   }
+
+   if( result == CONV_OK )
+      return 0;
+
+   struct OPTION_ERROR_T error =
+   {
+      .code        = (result == CONV_RANGE)? OPT_ERR_ARGUMENT_OUT_OF_RANGE :
+                                             OPT_ERR_INVALID_ARGUMENT,
+      .argvIndex   = pArg->argvIndex,
+      .pToken      = pArg->optArg,
+      .tokenLength = strlen( pArg->optArg ),
+      .pBlock      = pBlock
+   };
+   reportError( (pArg->pContext != NULL)? pArg->pContext->pErrorSink : NULL,
+                pArg->ppAgv[0], &error );
+   return -1;
+}
+#endif /* ifndef CONFIG_CLOP_NO_TYPED_VALUES */
+
+#ifndef CONFIG_CLOP_NO_STREAM
+/*
+ * Maximum number of arguments which can be consumed by a single option:
+ * "-O = ARGUMENT" respectively "--OPTION = ARGUMENT"
+ */
+#define STREAM_WINDOW_SIZE 3
+
+/*
+ * Maximum length of the begin of a too long argument in the error record.
+ */
+#define STREAM_TOKEN_PREVIEW 32
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void initOptionStream( struct OPTION_STREAM_T* pStream,
+                       OPT_READ_F read, void* pSource,
+                       char* pBuffer, size_t bufferSize )
+{
+   memset( pStream, 0, sizeof( struct OPTION_STREAM_T ) );
+   pStream->read       = read;
+   pStream->pSource    = pSource;
+   pStream->pBuffer    = pBuffer;
+   pStream->bufferSize = bufferSize;
+   pStream->delimiter  = ' ';
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+long readOptionStreamFd( void* pSource, char* pBuffer, size_t size )
+{
+   ssize_t ret;
+
+   do
+      ret = read( *(int*)pSource, pBuffer, size );
+   while( (ret < 0) && (errno == EINTR) );
+   return ret;
+}
+
+/*-----------------------------------------------------------------------------
+ * Moves the still needed data to the begin of the buffer.
+ */
+static void compactStreamBuffer( struct OPTION_STREAM_T* pStream,
+                                 char* ppWindow[], int count )
+{
+   size_t shift = pStream->begin;
+   int i;
+
+   memmove( pStream->pBuffer, &pStream->pBuffer[shift], pStream->end - shift );
+   for( i = 1; i < count; i++ )
+      ppWindow[i] -= shift;
+   pStream->begin      = 0;
+   pStream->tokenStart -= shift;
+   pStream->scan       -= shift;
+   pStream->end        -= shift;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int streamError( struct OPTION_ERROR_SINK_T* pSink, const char* prgName,
+                        OPT_ERROR_CODE_T code, int index,
+                        const char* pToken, size_t tokenLength )
+{
+   struct OPTION_ERROR_T error =
+   {
+      .code        = code,
+      .argvIndex   = index,
+      .pToken      = pToken,
+      .tokenLength = tokenLength
+   };
+   reportError( pSink, prgName, &error );
+   return -1;
+}
+
+/*-----------------------------------------------------------------------------
+ * Delivers the next argument of the stream, terminated in place.
+ * Returns 1 if a argument is present, 0 by the end of the stream and
+ * -1 in the case of an error.
+ */
+static int fetchStreamArgument( struct OPTION_STREAM_T* pStream,
+                                struct OPTION_ERROR_SINK_T* pSink,
+                                const char* prgName,
+                                char* ppWindow[], int count )
+{
+   char* pB = pStream->pBuffer;
+   size_t length;
+   long  n;
+   char  c;
+
+   while( true )
+   {
+      if( (pStream->delimiter == ' ') && (pStream->tokenStart == pStream->scan) )
+      {  /* Runs of white spaces are a single delimiter. */
+         while( (pStream->scan < pStream->end) && IS_SPACE( pB[pStream->scan] ) )
+            pStream->scan++;
+         pStream->tokenStart = pStream->scan;
+      }
+
+      while( pStream->scan < pStream->end )
+      {
+         c = pB[pStream->scan];
+         if( (pStream->delimiter == ' ')? IS_SPACE( c ) : (c == pStream->delimiter) )
+         {
+            pB[pStream->scan++] = '\0';
+            ppWindow[count] = &pB[pStream->tokenStart];
+            pStream->tokenStart = pStream->scan;
+            return 1;
+         }
+         pStream->scan++;
+      }
+
+      if( pStream->eof )
+      {
+         if( pStream->tokenStart == pStream->end )
+            return 0;
+         /* Last argument without delimiter, one byte is always reserved. */
+         pB[pStream->end++] = '\0';
+         ppWindow[count] = &pB[pStream->tokenStart];
+         pStream->tokenStart = pStream->scan = pStream->end;
+         return 1;
+      }
+
+      if( (pStream->end + 1) >= pStream->bufferSize )
+      {
+         if( pStream->begin == 0 )
+         {
+            length = pStream->end - pStream->tokenStart;
+            if( length > STREAM_TOKEN_PREVIEW )
+               length = STREAM_TOKEN_PREVIEW;
+            return streamError( pSink, prgName, OPT_ERR_ARGUMENT_TOO_LONG, count,
+                                &pB[pStream->tokenStart], length );
+         }
+         compactStreamBuffer( pStream, ppWindow, count );
+      }
+
+      n = pStream->read( pStream->pSource, &pB[pStream->end],
+                         pStream->bufferSize - 1 - pStream->end );
+      if( n < 0 )
+         return streamError( pSink, prgName, OPT_ERR_READ_FAILED, count, NULL, 0 );
+      if( n == 0 )
+         pStream->eof = true;
+      pStream->end += n;
+   }
+}
+
+/*-----------------------------------------------------------------------------
+ * The parser works on a sliding window of the stream: ppWindow[0] is the
+ * program name, ppWindow[1] the argument to parse followed by the
+ * arguments which could be consumed by it.
+ */
+static int parseStream( struct OPTION_STREAM_T* pStream,
+                        const char* prgName,
+                        struct OPTION_CONTEXT_T* pContext )
+{
+   char* ppWindow[STREAM_WINDOW_SIZE + 2] = { (char*)prgName };
+   int   count = 1;
+   int   ret;
+   bool  error = false;
+   struct OPTION_BLOCK_T* optBlockList =
+      (pContext->pTable != NULL)? pContext->pTable->pOptBlockList :
+                                  pContext->pOptBlockList;
+
+#ifndef CONFIG_CLOP_NO_TYPED_VALUES
+   static const char pointerDefect[] =
+      "storing a pointer to its argument in a argument stream";
+   BLK_LIST_ITERATOR_T pBlock;
+#endif
+
+   assert( pStream->bufferSize > 1 );
+
+#ifndef CONFIG_CLOP_NO_TYPED_VALUES
+   FOR_EACH_OPTION_BLOCK( pBlock, optBlockList )
+   {  /* The values would point into the buffer. */
+      if( !storesArgumentPointer( pBlock ) )
+         continue;
+      struct OPTION_ERROR_T pointerError =
+      {
+         .code        = OPT_ERR_INVALID_OPTION_BLOCK,
+         .argvIndex   = (int)(pBlock - optBlockList),
+         .pToken      = pointerDefect,
+         .tokenLength = sizeof( pointerDefect ) - 1,
+         .pBlock      = pBlock
+      };
+      reportError( pContext->pErrorSink, prgName, &pointerError );
+      return -1;
+   }
+#endif
+
+   while( true )
+   {
+      pStream->begin = (count > 1)? (size_t)(ppWindow[1] - pStream->pBuffer) :
+                                    pStream->tokenStart;
+      while( count <= STREAM_WINDOW_SIZE )
+      {
+         ret = fetchStreamArgument( pStream, pContext->pErrorSink, prgName,
+                                    ppWindow, count );
+         if( ret < 0 )
+            return ret;
+         if( ret == 0 )
+            break;
+         count++;
+      }
+      if( count == 1 )
+         break; /* End of stream. */
+      ppWindow[count] = NULL;
+
+      ret = parseCommandLine( 1, 2, count, ppWindow, pContext, NULL, &error );
+      if( ret < 0 )
+         return ret;
+
+      if( ret == 1 )
+      {  /* Non option argument. */
+         if( pStream->nonOptionFunction == NULL )
+            return streamError( pContext->pErrorSink, prgName,
+                                OPT_ERR_UNEXPECTED_NON_OPTION, 1,
+                                ppWindow[1], strlen( ppWindow[1] ) );
+         struct BLOCK_FUNCTION_ARG_T arg =
+         {
+            .argc          = count,
+            .ppAgv         = ppWindow,
+            .argvIndex     = 1,
+            .optArg        = ppWindow[1],
+            .pOptBlockList = optBlockList,
+            .pOptTable     = pContext->pTable,
+            .pContext      = pContext,
+            .pUser         = pContext->pUser,
+            .pArena        = pContext->pArena
+         };
+         ret = pStream->nonOptionFunction( &arg );
+         if( ret < 0 )
+            return ret;
+         if( ret > 0 )
+            error = true;
+         ret = 2;
+      }
+      if( ret > count )
+         ret = count;
+
+      /* Shifting out the consumed arguments. */
+      memmove( &ppWindow[1], &ppWindow[ret], (count - ret) * sizeof( char* ) );
+      count -= ret - 1;
+   }
+   return error? -1 : 0;
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int parseOptionStream( struct OPTION_STREAM_T* pStream,
+                       const char* prgName,
+                       struct OPTION_BLOCK_T optBlockList[],
+                       void* pUser )
+{
+   struct OPTION_CONTEXT_T context =
+   {
+      .pOptBlockList = optBlockList,
+      .pUser         = pUser
+   };
+   return parseStream( pStream, prgName, &context );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int parseOptionStreamTable( struct OPTION_STREAM_T* pStream,
+                            const char* prgName,
+                            const struct OPTION_TABLE_T* pTable,
+                            void* pUser )
+{
+   struct OPTION_CONTEXT_T context =
+   {
+      .pTable = pTable,
+      .pUser  = pUser
+   };
+   assert( pTable != NULL );
+   return parseStream( pStream, prgName, &context );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int parseOptionStreamContext( struct OPTION_STREAM_T* pStream,
+                              const char* prgName,
+                              struct OPTION_CONTEXT_T* pContext )
+{
+   assert( pContext != NULL );
+   return parseStream( pStream, prgName, pContext );
+}
+#endif /* ifndef CONFIG_CLOP_NO_STREAM */
+
+#ifndef CONFIG_CLOP_NO_RESPONSE_FILES
+/*
+ * Maximum nesting depth of response files, protects against cycles.
+ */
+#define MAX_RESPONSE_FILE_DEPTH 64
+
+/*-----------------------------------------------------------------------------
+ * Reports the error of the currently expanded argument of the origin
+ * vector. The token is this argument, because the mappings of the nested
+ * response files don't survive the error.
+ */
+static int responseFileError( struct RESPONSE_FILE_ARGS_T* pArgs,
+                              OPT_ERROR_CODE_T code )
+{
+   const char* pArgument = (pArgs->argvIndex > 0)?
+                           pArgs->ppOrigin[pArgs->argvIndex] : NULL;
+   struct OPTION_ERROR_T error =
+   {
+      .code        = code,
+      .argvIndex   = pArgs->argvIndex,
+      .pToken      = pArgument,
+      .tokenLength = (pArgument != NULL)? strlen( pArgument ) : 0
+   };
+   reportError( pArgs->pErrorSink, pArgs->ppOrigin[0], &error );
+   return -1;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int appendArgument( struct RESPONSE_FILE_ARGS_T* pArgs,
+                           size_t* pCapacity, char* pArgument )
+{
+   char** ppNew;
+
+   if( (size_t)pArgs->argc + 1 >= *pCapacity )
+   {
+      *pCapacity *= 2;
+      ppNew = realloc( pArgs->ppArgv, *pCapacity * sizeof( char* ) );
+      if( ppNew == NULL )
+         return responseFileError( pArgs, OPT_ERR_OUT_OF_MEMORY );
+      pArgs->ppArgv = ppNew;
+   }
+   pArgs->ppArgv[pArgs->argc++] = pArgument;
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ * Maps the file with a additional zeroed byte behind its end, so that the
+ * last argument can be terminated in place as well.
+ * Returns 1 if the file can't be used as response file.
+ */
+static int mapResponseFile( struct RESPONSE_FILE_ARGS_T* pArgs,
+                            const char* pPath, char** ppData, size_t* pSize )
+{
+   struct RESPONSE_FILE_MAP_T* pNewMaps;
+   struct stat st;
+   size_t mapSize;
+   void* pAddress;
+   int fd;
+
+   fd = open( pPath, O_RDONLY );
+   if( fd < 0 )
+      return 1;
+   if( (fstat( fd, &st ) != 0) || !S_ISREG( st.st_mode ) )
+   {
+      close( fd );
+      return 1;
+   }
+   *pSize = st.st_size;
+   if( *pSize == 0 )
+   {
+      close( fd );
+      *ppData = NULL;
+      return 0;
+   }
+
+   pNewMaps = realloc( pArgs->pMaps,
+                       (pArgs->numOfMaps + 1) * sizeof( struct RESPONSE_FILE_MAP_T ) );
+   if( pNewMaps == NULL )
+   {
+      close( fd );
+      return responseFileError( pArgs, OPT_ERR_OUT_OF_MEMORY );
+   }
+   pArgs->pMaps = pNewMaps;
+
+   /* Anonymous reservation first, the file becomes mapped over it. */
+   mapSize = *pSize + 1;
+   pAddress = mmap( NULL, mapSize, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+   if( pAddress == MAP_FAILED )
+   {
+      close( fd );
+      return responseFileError( pArgs, OPT_ERR_RESPONSE_FILE_NOT_MAPPABLE );
+   }
+   pArgs->pMaps[pArgs->numOfMaps].pAddress = pAddress;
+   pArgs->pMaps[pArgs->numOfMaps].size     = mapSize;
+   pArgs->numOfMaps++;
+
+   if( mmap( pAddress, *pSize, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_FIXED, fd, 0 ) == MAP_FAILED )
+   {
+      close( fd );
+      return responseFileError( pArgs, OPT_ERR_RESPONSE_FILE_NOT_MAPPABLE );
+   }
+   close( fd );
+   *ppData = pAddress;
+   return 0;
+}
+
+static int expandArguments( struct RESPONSE_FILE_ARGS_T* pArgs,
+                            size_t* pCapacity, char* pArgument,
+                            unsigned int depth );
+
+/*-----------------------------------------------------------------------------
+ * Tokenizer like buildargv() of the GNU libiberty. The write pointer
+ * never overtakes the read pointer, so the tokens can be made in place.
+ */
+static int expandResponseFile( struct RESPONSE_FILE_ARGS_T* pArgs,
+                               size_t* pCapacity, char* pData, size_t size,
+                               unsigned int depth )
+{
+   char* pRead  = pData;
+   char* pEnd   = pData + size;
+   char* pWrite;
+   char* pToken;
+   char  quote;
+   int   ret;
+
+   while( true )
+   {
+      while( (pRead < pEnd) && IS_SPACE( *pRead ) )
+         pRead++;
+      if( pRead >= pEnd )
+         return 0;
+
+      pToken = pWrite = pRead;
+      quote = '\0';
+      while( pRead < pEnd )
+      {
+         if( *pRead == '\\' )
+         {
+            pRead++;
+            if( pRead < pEnd )
+               *pWrite++ = *pRead++;
+            continue;
+         }
+         if( quote != '\0' )
+         {
+            if( *pRead == quote )
+               quote = '\0';
+            else
+               *pWrite++ = *pRead;
+            pRead++;
+            continue;
+         }
+         if( IS_SPACE( *pRead ) )
+            break;
+         if( (*pRead == '\'') || (*pRead == '"') )
+            quote = *pRead;
+         else
+            *pWrite++ = *pRead;
+         pRead++;
+      }
+      pRead++;
+      *pWrite = '\0';
+
+      ret = expandArguments( pArgs, pCapacity, pToken, depth );
+      if( ret != 0 )
+         return ret;
+   }
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int expandArguments( struct RESPONSE_FILE_ARGS_T* pArgs,
+                            size_t* pCapacity, char* pArgument,
+                            unsigned int depth )
+{
+   char*  pData = NULL;
+   size_t size;
+   int    ret;
+
+   if( pArgument[0] != '@' )
+      return appendArgument( pArgs, pCapacity, pArgument );
+
+   if( depth >= MAX_RESPONSE_FILE_DEPTH )
+      return responseFileError( pArgs, OPT_ERR_RESPONSE_FILE_TOO_DEEP );
+
+   ret = mapResponseFile( pArgs, &pArgument[1], &pData, &size );
+   if( ret > 0 )
+      return appendArgument( pArgs, pCapacity, pArgument );
+   if( (ret < 0) || (pData == NULL) )
+      return ret;
+
+   return expandResponseFile( pArgs, pCapacity, pData, size, depth + 1 );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int expandResponseFiles( struct RESPONSE_FILE_ARGS_T* pArgs,
+                         int argc, char* const ppArgv[] )
+{
+   return expandResponseFilesWithSink( pArgs, argc, ppArgv, NULL );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int expandResponseFilesWithSink( struct RESPONSE_FILE_ARGS_T* pArgs,
+                                 int argc, char* const ppArgv[],
+                                 struct OPTION_ERROR_SINK_T* pSink )
+{
+   size_t capacity = argc + 1;
+   int i;
+
+   pArgs->argc       = 0;
+   pArgs->pMaps      = NULL;
+   pArgs->numOfMaps  = 0;
+   pArgs->pErrorSink = pSink;
+   pArgs->ppOrigin   = ppArgv;
+   pArgs->argvIndex  = 0;
+   pArgs->ppArgv     = malloc( capacity * sizeof( char* ) );
+   if( pArgs->ppArgv == NULL )
+      return responseFileError( pArgs, OPT_ERR_OUT_OF_MEMORY );
+   pArgs->ppArgv[pArgs->argc++] = ppArgv[0];
+
+   for( i = 1; i < argc; i++ )
+   {
+      pArgs->argvIndex = i;
+      if( expandArguments( pArgs, &capacity, ppArgv[i], 0 ) != 0 )
+      {
+         releaseResponseFiles( pArgs );
+         return -1;
+      }
+   }
+   pArgs->ppArgv[pArgs->argc] = NULL;
+   return 0;
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void releaseResponseFiles( struct RESPONSE_FILE_ARGS_T* pArgs )
+{
+   while( pArgs->numOfMaps > 0 )
+   {
+      pArgs->numOfMaps--;
+      munmap( pArgs->pMaps[pArgs->numOfMaps].pAddress,
+              pArgs->pMaps[pArgs->numOfMaps].size );
+   }
+   free( pArgs->pMaps );
+   free( pArgs->ppArgv );
+   pArgs->pMaps  = NULL;
+   pArgs->ppArgv = NULL;
+   pArgs->argc   = 0;
+}
+#endif /* ifndef CONFIG_CLOP_NO_RESPONSE_FILES */
+
+#ifndef CONFIG_CLOP_NO_THREADS
+/*
+ * Upper limit of the number of items which a worker takes at once.
+ * Small enough for a good load balance, big enough to keep the atomic
+ * counter and the cache lines of the result array out of the workers way.
+ */
+#define BATCH_MAX_PORTION 64
+
+/*!----------------------------------------------------------------------------
+ * @brief Shared state of a batch, written only by the atomic counter.
+ */
+struct BATCH_T
+{
+   struct OPTION_BATCH_ITEM_T*  pItems;
+   size_t                       numOfItems;
+   size_t                       portion;
+   const struct OPTION_TABLE_T* pTable;
+   atomic_size_t                next;
+};
+
+/*-----------------------------------------------------------------------------
+ * Worker function: takes portions of items until all items are taken.
+ */
+static void* batchWorker( void* pArg )
+{
+   struct BATCH_T* pBatch = (struct BATCH_T*)pArg;
+   size_t i, end;
+
+   while( true )
+   {
+      i = atomic_fetch_add_explicit( &pBatch->next, pBatch->portion,
+                                     memory_order_relaxed );
+      if( i >= pBatch->numOfItems )
+         break;
+      end = i + pBatch->portion;
+      if( end > pBatch->numOfItems )
+         end = pBatch->numOfItems;
+      for( ; i < end; i++ )
+      {
+         struct OPTION_BATCH_ITEM_T* pItem = &pBatch->pItems[i];
+         struct OPTION_CONTEXT_T context =
+         {
+            .pTable     = pBatch->pTable,
+            .pErrorSink = pItem->pErrorSink,
+            .pUser      = pItem->pUser
+         };
+         pItem->result = parseCommandLineContextAt( 1, pItem->argc,
+                                                    pItem->ppArgv, &context );
+      }
+   }
+   return NULL;
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int parseCommandLineBatch( struct OPTION_BATCH_ITEM_T items[],
+                           size_t numOfItems,
+                           const struct OPTION_TABLE_T* pTable,
+                           unsigned int numOfThreads )
+{
+   struct BATCH_T batch;
+   pthread_t* pThreads;
+   unsigned int i, numOfStarted;
+   long numOfProcessors;
+
+   assert( pTable != NULL );
+   assert( (items != NULL) || (numOfItems == 0) );
+
+   if( numOfThreads == 0 )
+   {
+      numOfProcessors = sysconf( _SC_NPROCESSORS_ONLN );
+      numOfThreads = (numOfProcessors > 0)? (unsigned int)numOfProcessors : 1;
+   }
+
+   batch.pItems     = items;
+   batch.numOfItems = numOfItems;
+   batch.pTable     = pTable;
+   /* At least some portions per thread for the load balance. */
+   batch.portion    = numOfItems / ((size_t)numOfThreads * 8);
+   if( batch.portion == 0 )
+      batch.portion = 1;
+   else if( batch.portion > BATCH_MAX_PORTION )
+      batch.portion = BATCH_MAX_PORTION;
+   atomic_init( &batch.next, 0 );
+
+   /* Not more threads than portions. */
+   if( numOfThreads > (numOfItems + batch.portion - 1) / batch.portion )
+      numOfThreads = (numOfItems + batch.portion - 1) / batch.portion;
+
+   numOfStarted = 0;
+   pThreads = NULL;
+   if( numOfThreads > 1 )
+   {
+      pThreads = malloc( (numOfThreads - 1) * sizeof( pthread_t ) );
+      if( pThreads == NULL )
+         numOfThreads = 1; /* The calling thread does the job alone. */
+      for( i = 0; i < (numOfThreads - 1); i++ )
+      {
+         if( pthread_create( &pThreads[i], NULL, batchWorker, &batch ) != 0 )
+            break; /* The remaining workers do the job. */
+         numOfStarted++;
+      }
+   }
+
+   batchWorker( &batch );
+
+   for( i = 0; i < numOfStarted; i++ )
+      pthread_join( pThreads[i], NULL );
+   free( pThreads );
+
+   return 0;
+}
+#endif /* ifndef CONFIG_CLOP_NO_THREADS */
+
+/*
+ * Size of the stack buffer for the rendered help text, larger texts
+ * becomes rendered in a heap buffer.
+ */
+#define RENDER_STACK_BUFFER_SIZE 4096
+
+/*
+ * Size of the stack buffer of the write functions, the text becomes written
+ * piecewise when it's longer.
+ */
+#define RENDER_WRITE_BUFFER_SIZE 128
+
+/*!----------------------------------------------------------------------------
+ * @brief Target of the render functions with the semantic of snprintf():
+ *        the length counts always, but the buffer becomes written
+ *        within its size only. \n
+ *        With a write function the buffer becomes flushed when it's full,
+ *        length is then the number of the not yet written characters.
+ */
+struct RENDER_T
+{
+   char*       pBuffer;
+   size_t      size;
+   size_t      length;
+   OPT_WRITE_F write;
+   void*       pHandle;
+};
+
+/*-----------------------------------------------------------------------------
+*/
+static void renderFlush( struct RENDER_T* pRender )
+{
+   if( pRender->length > 0 )
+      pRender->write( pRender->pHandle, pRender->pBuffer, pRender->length );
+   pRender->length = 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static inline void renderChar( struct RENDER_T* pRender, char c )
+{
+   if( (pRender->write != NULL) && (pRender->length == pRender->size) )
+      renderFlush( pRender );
+   if( pRender->length < pRender->size )
+      pRender->pBuffer[pRender->length] = c;
+   pRender->length++;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void renderMemory( struct RENDER_T* pRender, const char* pData, size_t len )
+{
+   size_t part;
+
+   if( pRender->write != NULL )
+   {
+      while( (pRender->length + len) > pRender->size )
+      {
+         part = pRender->size - pRender->length;
+         memcpy( &pRender->pBuffer[pRender->length], pData, part );
+         pRender->length += part;
+         renderFlush( pRender );
+         pData += part;
+         len   -= part;
+      }
+   }
+   if( (pRender->length + len) <= pRender->size )
+      memcpy( &pRender->pBuffer[pRender->length], pData, len );
+   else if( pRender->length < pRender->size )
+      memcpy( &pRender->pBuffer[pRender->length], pData,
+              pRender->size - pRender->length );
+   pRender->length += len;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static inline void renderString( struct RENDER_T* pRender, const char* str )
+{
+   renderMemory( pRender, str, strlen( str ) );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static size_t renderTerminate( struct RENDER_T* pRender )
+{
+   if( pRender->size > 0 )
+   {
+      if( pRender->length < pRender->size )
+         pRender->pBuffer[pRender->length] = '\0';
+      else
+         pRender->pBuffer[pRender->size - 1] = '\0';
+   }
+   return pRender->length;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void renderOptionBlock( struct RENDER_T* pRender,
+                               const struct OPTION_BLOCK_T* pOptionBlock )
+{
+   const char* pParam = "";
+   assert( (pOptionBlock->shortOpt != 0) || (pOptionBlock->longOpt != NULL) );
+
+   switch( pOptionBlock->hasArg )
+   {
+   #ifndef CONFIG_CLOP_NO_NO_ARG
+      case NO_ARG:                             break;
+   #endif
+   #ifndef CONFIG_CLOP_NO_REQUIRED_ARG
+      case REQUIRED_ARG: pParam = " PARAM";    break;
+   #endif
+   #ifndef CONFIG_CLOP_NO_OPTIONAL_ARG
+      case OPTIONAL_ARG: pParam = " [=PARAM]"; break;
+   #endif
+      default: assert( false ); break;
+   }
+
+   if( pOptionBlock->shortOpt != 0 )
+   {
+      renderChar( pRender, '-' );
+      renderChar( pRender, pOptionBlock->shortOpt );
+      renderString( pRender, pParam );
+      if( pOptionBlock->longOpt != NULL )
+         renderString( pRender, ", " );
+   }
+   if( pOptionBlock->longOpt != NULL )
+   {
+      renderString( pRender, "--" );
+      renderString( pRender, pOptionBlock->longOpt );
+      renderString( pRender, pParam );
+   }
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void renderHelpText( struct RENDER_T* pRender, const char* helpText )
+{
+   const char* pC;
+   const char* pLineEnd;
+
+   renderString( pRender, "\n\t" );
+   if( helpText != NULL )
+   {  /* Each line of the help text becomes indented by a tabulator. */
+      pC = helpText;
+      while( (pLineEnd = strchr( pC, '\n' )) != NULL )
+      {
+         renderMemory( pRender, pC, pLineEnd - pC );
+         renderString( pRender, "\n\t" );
+         pC = pLineEnd + 1;
+      }
+      renderString( pRender, pC );
+   }
+   renderString( pRender, "\n\n" );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void renderOptionListItem( struct RENDER_T* pRender,
+                                  const struct OPTION_BLOCK_T* pBlock )
+{
+   renderString( pRender, "  " );
+   renderOptionBlock( pRender, pBlock );
+   renderHelpText( pRender, pBlock->helpText );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+size_t renderOption( char* pBuffer, size_t size,
+                     const struct OPTION_BLOCK_T* pOptionBlock )
+{
+   struct RENDER_T render = { .pBuffer = pBuffer, .size = size };
+
+   renderOptionBlock( &render, pOptionBlock );
+   return renderTerminate( &render );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+size_t renderOptionList( char* pBuffer, size_t size,
+                         struct OPTION_BLOCK_T optBlockList[] )
+{
+   struct RENDER_T render = { .pBuffer = pBuffer, .size = size };
+   BLK_LIST_ITERATOR_T pBlock;
+
+   FOR_EACH_OPTION_BLOCK( pBlock, optBlockList )
+      renderOptionListItem( &render, pBlock );
+   return renderTerminate( &render );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void writeOption( OPT_WRITE_F write, void* pHandle,
+                  const struct OPTION_BLOCK_T* pOptionBlock )
+{
+   char buffer[RENDER_WRITE_BUFFER_SIZE];
+   struct RENDER_T render =
+   {
+      .pBuffer = buffer,
+      .size    = sizeof( buffer ),
+      .write   = write,
+      .pHandle = pHandle
+   };
+
+   renderOptionBlock( &render, pOptionBlock );
+   renderFlush( &render );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void writeOptionList( OPT_WRITE_F write, void* pHandle,
+                      struct OPTION_BLOCK_T optBlockList[] )
+{
+   char buffer[RENDER_WRITE_BUFFER_SIZE];
+   struct RENDER_T render =
+   {
+      .pBuffer = buffer,
+      .size    = sizeof( buffer ),
+      .write   = write,
+      .pHandle = pHandle
+   };
+   BLK_LIST_ITERATOR_T pBlock;
+
+   FOR_EACH_OPTION_BLOCK( pBlock, optBlockList )
+      renderOptionListItem( &render, pBlock );
+   renderFlush( &render );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void writeSubcommandList( OPT_WRITE_F write, void* pHandle,
+                          const struct OPTION_SUBCOMMAND_T subcommands[] )
+{
+   char buffer[RENDER_WRITE_BUFFER_SIZE];
+   struct RENDER_T render =
+   {
+      .pBuffer = buffer,
+      .size    = sizeof( buffer ),
+      .write   = write,
+      .pHandle = pHandle
+   };
+   const struct OPTION_SUBCOMMAND_T* pSubcommand;
+
+   for( pSubcommand = subcommands; pSubcommand->name != NULL; pSubcommand++ )
+   {
+      renderString( &render, "  " );
+      renderString( &render, pSubcommand->name );
+      renderHelpText( &render, pSubcommand->helpText );
+   }
+   renderFlush( &render );
+}
+
+#ifndef CONFIG_CLOP_NO_STDIO
+/*-----------------------------------------------------------------------------
+ * Write function of completeCommandLine() without own write function.
+ */
+static void writeStdout( void* pHandle, const char* pData, size_t length )
+{
+   fwrite( pData, 1, length, (FILE*)pHandle );
+}
+#endif
+
+/*-----------------------------------------------------------------------------
+ * Renders a line of the completion answer: the candidate and the first line
+ * of the help text separated by a tabulator.
+ */
+static void renderCandidate( struct RENDER_T* pRender, const char* pPrefix,
+                             const char* word, const char* helpText )
+{
+   const char* pLineEnd;
+
+   renderString( pRender, pPrefix );
+   renderString( pRender, word );
+   if( helpText != NULL )
+   {
+      pLineEnd = strchr( helpText, '\n' );
+      renderChar( pRender, '\t' );
+      renderMemory( pRender, helpText, (pLineEnd != NULL)? (size_t)(pLineEnd - helpText) :
+                                                           strlen( helpText ) );
+   }
+   renderChar( pRender, '\n' );
+}
+
+/*-----------------------------------------------------------------------------
+ * Long option candidates by the sorted name index in O(log n) plus the
+ * number of candidates, otherwise by a linear search.
+ */
+static void renderLongCandidates( struct RENDER_T* pRender,
+                                  struct OPTION_BLOCK_T optBlockList[],
+                                  const struct OPTION_TABLE_T* pTable,
+                                  const char* pName, size_t len )
+{
+   BLK_LIST_ITERATOR_T pBlock;
+   uint32_t first, n, i;
+
+   if( (pTable != NULL) && (pTable->ppPrefixIndex != NULL) )
+   {
+      n = findPrefixRange( pTable, pName, len, &first );
+      for( i = first; i < (first + n); i++ )
+         renderCandidate( pRender, "--", pTable->ppPrefixIndex[i]->longOpt,
+                          pTable->ppPrefixIndex[i]->helpText );
+      return;
+   }
+   if( pTable != NULL )
+   {  /* Linear search over the packed lengths and the name pool only. */
+      for( i = 0; i < pTable->numOfBlocks; i++ )
+      {
+         if( (pTable->pLengths[i] != 0) && (pTable->pLengths[i] >= len) &&
+             (memcmp( &pTable->pNamePool[pTable->pNameOffsets[i]], pName, len ) == 0) )
+            renderCandidate( pRender, "--", &pTable->pNamePool[pTable->pNameOffsets[i]],
+                             pTable->pOptBlockList[i].helpText );
+      }
+      return;
+   }
+   FOR_EACH_OPTION_BLOCK( pBlock, optBlockList )
+   {
+      if( (pBlock->longOpt != NULL) && (strncmp( pBlock->longOpt, pName, len ) == 0) )
+         renderCandidate( pRender, "--", pBlock->longOpt, pBlock->helpText );
+   }
+}
+
+/*-----------------------------------------------------------------------------
+ * Candidates of a option-argument: the names of OPT_TYPE_ENUM.
+ */
+static void renderArgumentCandidates( struct RENDER_T* pRender,
+                                      const struct OPTION_BLOCK_T* pBlock,
+                                      const char* pValue )
+{
+#ifndef CONFIG_CLOP_NO_TYPED_VALUES
+   const char* const* ppName;
+   const size_t len = strlen( pValue );
+
+   if( (pBlock->valueType != OPT_TYPE_ENUM) || (pBlock->pValueInfo == NULL) )
+      return;
+   for( ppName = pBlock->pValueInfo; *ppName != NULL; ppName++ )
+   {
+      if( strncmp( *ppName, pValue, len ) == 0 )
+         renderCandidate( pRender, "", *ppName, NULL );
+   }
+#else
+   (void)pRender;
+   (void)pBlock;
+   (void)pValue;
+#endif
+}
+
+/*-----------------------------------------------------------------------------
+ * Returns the option block of which ppAgv[limit] is the argument, by
+ * parsing the words before it like parseCommandLineOptionsAt().
+ * NULL if ppAgv[limit] isn't a option-argument.
+ */
+static const struct OPTION_BLOCK_T* completionArgumentOf( int offset, int limit,
+                                                           char* const ppAgv[],
+                                                           struct OPTION_BLOCK_T optBlockList[],
+                                                           const struct OPTION_TABLE_T* pTable )
+{
+   struct OPTION_ERROR_T error;
+   struct OPTION_ERROR_SINK_T errorSink = { .pErrors = &error, .capacity = 1 };
+   struct OPTION_ITERATOR_T it;
+
+   initIterator( &it, offset, limit, ppAgv, optBlockList, pTable );
+   it.pErrorSink = &errorSink;
+   while( true )
+   {
+      switch( parseNextOption( &it ) )
+      {
+         case OPT_ITER_FOUND:
+         case OPT_ITER_UNKNOWN:
+         {
+            errorSink.count = 0;
+            break;
+         }
+         case OPT_ITER_END:
+         {
+            if( it.argvIndex >= limit )
+               return NULL;
+            /* Mixed order: the options after the non-option argument. */
+            initIterator( &it, it.argvIndex + 1, limit, ppAgv, optBlockList, pTable );
+            it.pErrorSink = &errorSink;
+            break;
+         }
+         default:
+         {  /* The argument is missing because the words ends. */
+            if( (errorSink.count == 1) &&
+                ((error.code == OPT_ERR_MISSING_ARGUMENT) ||
+                 (error.code == OPT_ERR_MISSING_ARGUMENT_AFTER_EQUAL)) )
+               return error.pBlock;
+            return NULL;
+         }
+      }
+   }
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+int completeCommandLine( int argc,
+                         char* const ppAgv[],
+                         struct OPTION_CONTEXT_T* pContext,
+                         OPT_WRITE_F write,
+                         void* pHandle
+                       )
+{
+   const struct OPTION_TABLE_T* pTable = pContext->pTable;
+   struct OPTION_BLOCK_T* pOptBlockList = (pTable != NULL)? pTable->pOptBlockList :
+                                                            pContext->pOptBlockList;
+   const struct OPTION_BLOCK_T* pBlock;
+   BLK_LIST_ITERATOR_T pListBlock;
+   const char* pWord;
+   const char* pEqual;
+   char buffer[RENDER_WRITE_BUFFER_SIZE];
+   struct RENDER_T render =
+   {
+      .pBuffer = buffer,
+      .size    = sizeof( buffer ),
+      .write   = write,
+      .pHandle = pHandle
+   };
+
+   if( (argc < 2) || (strcmp( ppAgv[1], OPTION_COMPLETE_COMMAND ) != 0) )
+      return 0;
+#ifndef CONFIG_CLOP_NO_STDIO
+   if( render.write == NULL )
+   {
+      render.write   = writeStdout;
+      render.pHandle = stdout;
+   }
+#endif
+   assert( render.write != NULL );
+
+   /* The last word is the one to complete, it can be empty. */
+   pWord = (argc > 2)? ppAgv[argc - 1] : "";
+   pBlock = (argc > 2)? completionArgumentOf( 2, argc - 1, ppAgv, pOptBlockList, pTable ) :
+                        NULL;
+   if( pBlock != NULL )
+   {
+      renderString( &render, OPTION_COMPLETE_ARGUMENT "\n" );
+      renderArgumentCandidates( &render, pBlock, pWord );
+   }
+   else if( (pWord[0] == '-') && (pWord[1] == '-') )
+   {
+      pWord += 2;
+      pEqual = strchr( pWord, '=' );
+      if( pEqual == NULL )
+      {
+         renderString( &render, OPTION_COMPLETE_OPTION "\n" );
+         renderLongCandidates( &render, pOptBlockList, pTable, pWord, strlen( pWord ) );
+      }
+      else
+      {  /* "--OPTION=ARGUMENT" */
+         pBlock = (pTable != NULL)?
+                  findLongOptionInTable( pTable, pWord, pEqual - pWord,
+                                         optionNameHash( pWord, pEqual - pWord ) ) :
+                  findLongOptionInList( pOptBlockList, pWord, pEqual - pWord );
+         renderString( &render, OPTION_COMPLETE_ARGUMENT "\n" );
+         if( pBlock != NULL )
+            renderArgumentCandidates( &render, pBlock, pEqual + 1 );
+      }
+   }
+   else if( pWord[0] == '-' )
+   {
+      renderString( &render, OPTION_COMPLETE_OPTION "\n" );
+      if( pWord[1] == '\0' )
+      {  /* All short and long options. */
+         char shortOpt[2] = { 0, 0 };
+         uint32_t i;
+         if( pTable != NULL )
+         {  /* Touches only the blocks with a short option. */
+            for( i = 0; i < pTable->numOfBlocks; i++ )
+            {
+               shortOpt[0] = pTable->pShortOpts[i];
+               if( shortOpt[0] != 0 )
+                  renderCandidate( &render, "-", shortOpt, pOptBlockList[i].helpText );
+            }
+         }
+         else
+         {
+            FOR_EACH_OPTION_BLOCK( pListBlock, pOptBlockList )
+            {
+               shortOpt[0] = pListBlock->shortOpt;
+               if( shortOpt[0] != 0 )
+                  renderCandidate( &render, "-", shortOpt, pListBlock->helpText );
+            }
+         }
+         renderLongCandidates( &render, pOptBlockList, pTable, "", 0 );
+      }
+      else
+      {  /* Complete short option, possibly with its argument. */
+         pBlock = (pTable != NULL)? pTable->shortOptIndex[(uint8_t)pWord[1]] :
+                                    findShortOptionInList( pOptBlockList, pWord[1] );
+         if( pBlock != NULL )
+            renderCandidate( &render, "", pWord, pBlock->helpText );
+      }
+   }
+   else
+   {
+      renderString( &render, OPTION_COMPLETE_OPERAND "\n" );
+   }
+   renderFlush( &render );
+   return 1;
+}
+
+#ifdef CONFIG_CLOP_STATISTICS
+/*-----------------------------------------------------------------------------
+*/
+static void renderUnsigned( struct RENDER_T* pRender, uint64_t value )
+{
+   char digits[20];
+
+   renderMemory( pRender, digits, formatUnsigned( digits, value ) );
+}
+
+/*-----------------------------------------------------------------------------
+ * Little endian, independent of the byte order of the machine.
+ */
+static void renderBinary( struct RENDER_T* pRender, uint64_t value,
+                          unsigned int numOfBytes )
+{
+   while( numOfBytes-- > 0 )
+   {
+      renderChar( pRender, (char)(value & 0xFF) );
+      value >>= 8;
+   }
+}
+
+/*-----------------------------------------------------------------------------
+ * Renders a JSON string in quotes, or null if str is NULL.
+ */
+static void renderJsonString( struct RENDER_T* pRender, const char* str )
+{
+   static const char hex[] = "0123456789abcdef";
+
+   if( str == NULL )
+   {
+      renderString( pRender, "null" );
+      return;
+   }
+   renderChar( pRender, '"' );
+   for( ; *str != '\0'; str++ )
+   {
+      if( (*str == '"') || (*str == '\\') )
+         renderChar( pRender, '\\' );
+      else if( (unsigned char)*str < 0x20 )
+      {
+         renderString( pRender, "\\u00" );
+         renderChar( pRender, hex[(unsigned char)*str >> 4] );
+         renderChar( pRender, hex[*str & 0x0F] );
+         continue;
+      }
+      renderChar( pRender, *str );
+   }
+   renderChar( pRender, '"' );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void renderStatistics( struct RENDER_T* pRender,
+                              const struct OPTION_STATISTICS_T* pStatistics,
+                              OPT_STAT_FORMAT_T format )
+{
+   const struct OPTION_BLOCK_STATISTIC_T* pBlockStatistic;
+   const struct OPTION_BLOCK_T* pBlock;
+   char shortOpt[2] = { 0 };
+   size_t i;
+
+   if( format == OPT_STAT_BINARY )
+   {
+      renderMemory( pRender, "CLST", 4 );
+      renderBinary( pRender, 1, 4 );
+      renderBinary( pRender, pStatistics->numOfBlocks, 4 );
+      renderBinary( pRender, pStatistics->parses, 8 );
+      renderBinary( pRender, pStatistics->lookups, 8 );
+      renderBinary( pRender, pStatistics->unknown, 8 );
+      renderBinary( pRender, pStatistics->lookupNanoseconds, 8 );
+      for( i = 0; i < pStatistics->numOfBlocks; i++ )
+      {
+         renderBinary( pRender, pStatistics->pBlocks[i].hits, 8 );
+         renderBinary( pRender, pStatistics->pBlocks[i].nanoseconds, 8 );
+      }
+      return;
+   }
+
+   renderString( pRender, "{\"parses\":" );
+   renderUnsigned( pRender, pStatistics->parses );
+   renderString( pRender, ",\"lookups\":" );
+   renderUnsigned( pRender, pStatistics->lookups );
+   renderString( pRender, ",\"unknown\":" );
+   renderUnsigned( pRender, pStatistics->unknown );
+   renderString( pRender, ",\"lookupNanoseconds\":" );
+   renderUnsigned( pRender, pStatistics->lookupNanoseconds );
+   renderString( pRender, ",\"options\":[" );
+   for( i = 0; i < pStatistics->numOfBlocks; i++ )
+   {
+      pBlock          = &pStatistics->pOptBlockList[i];
+      pBlockStatistic = &pStatistics->pBlocks[i];
+      shortOpt[0]     = pBlock->shortOpt;
+      renderString( pRender, (i == 0)? "\n{\"short\":" : ",\n{\"short\":" );
+      renderJsonString( pRender, (pBlock->shortOpt != 0)? shortOpt : NULL );
+      renderString( pRender, ",\"long\":" );
+      renderJsonString( pRender, pBlock->longOpt );
+      renderString( pRender, ",\"hits\":" );
+      renderUnsigned( pRender, pBlockStatistic->hits );
+      renderString( pRender, ",\"nanoseconds\":" );
+      renderUnsigned( pRender, pBlockStatistic->nanoseconds );
+      renderChar( pRender, '}' );
+   }
+   renderString( pRender, "\n]}\n" );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+size_t renderOptionStatistics( char* pBuffer, size_t size,
+                               const struct OPTION_STATISTICS_T* pStatistics,
+                               OPT_STAT_FORMAT_T format )
+{
+   struct RENDER_T render = { .pBuffer = pBuffer, .size = size };
+
+   renderStatistics( &render, pStatistics, format );
+   if( format == OPT_STAT_BINARY )
+      return render.length;
+   return renderTerminate( &render );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void writeOptionStatistics( OPT_WRITE_F write, void* pHandle,
+                            const struct OPTION_STATISTICS_T* pStatistics,
+                            OPT_STAT_FORMAT_T format )
+{
+   char buffer[RENDER_WRITE_BUFFER_SIZE];
+   struct RENDER_T render =
+   {
+      .pBuffer = buffer,
+      .size    = sizeof( buffer ),
+      .write   = write,
+      .pHandle = pHandle
+   };
+
+   renderStatistics( &render, pStatistics, format );
+   renderFlush( &render );
+}
+#endif /* ifdef CONFIG_CLOP_STATISTICS */
+
+#ifndef CONFIG_CLOP_FREESTANDING
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+char* createOptionListText( struct OPTION_BLOCK_T optBlockList[] )
+{
+   size_t size = renderOptionList( NULL, 0, optBlockList ) + 1;
+   char* pText = malloc( size );
+
+   if( pText != NULL )
+      renderOptionList( pText, size, optBlockList );
+   return pText;
+}
+#endif
+
+#ifndef CONFIG_CLOP_NO_TYPED_VALUES
+/*-----------------------------------------------------------------------------
+*/
+static void renderSigned( struct RENDER_T* pRender, int64_t value )
+{
+   char digits[20];
+
+   if( value < 0 )
+      renderChar( pRender, '-' );
+   renderMemory( pRender, digits,
+                 formatUnsigned( digits, (value < 0)? (0 - (uint64_t)value) :
+                                                      (uint64_t)value ) );
+}
+
+/*-----------------------------------------------------------------------------
+ * Details of the errors of storeOptionValue().
+ */
+static void renderConversionError( struct RENDER_T* pRender,
+                                   const struct OPTION_ERROR_T* pError )
+{
+   static const char* const expected[] =
+   {
+      [OPT_TYPE_INT32]  = "a integer number",
+      [OPT_TYPE_INT64]  = "a integer number",
+      [OPT_TYPE_UINT64] = "a unsigned integer number",
+      [OPT_TYPE_DOUBLE] = "a floating point number",
+      [OPT_TYPE_SIZE]   = "a size like 4096, 4K or 64MiB",
+      [OPT_TYPE_BOOL]   = "true, false, yes, no, on, off, 1 or 0",
+      [OPT_TYPE_ENUM]   = "one of:"
+   };
+   const struct OPTION_BLOCK_T* pBlock = pError->pBlock;
+   const struct OPTION_RANGE_T* pRange = pBlock->pValueInfo;
+   const char* const* ppName;
+   char digits[20];
+
+   renderString( pRender, "invalid argument \"" );
+   renderMemory( pRender, pError->pToken, pError->tokenLength );
+   renderString( pRender, "\" of option \"" );
+   renderOptionBlock( pRender, pBlock );
+   renderString( pRender, "\", " );
+
+   if( pError->code == OPT_ERR_INVALID_ARGUMENT )
+   {
+      renderString( pRender, "expected " );
+      renderString( pRender, expected[pBlock->valueType] );
+      if( pBlock->valueType == OPT_TYPE_ENUM )
+      {
+         for( ppName = pBlock->pValueInfo; *ppName != NULL; ppName++ )
+         {
+            renderChar( pRender, ' ' );
+            renderString( pRender, *ppName );
+         }
+      }
+      return;
+   }
+
+   renderString( pRender, "out of range" );
+   if( pRange == NULL )
+   {
+      renderString( pRender, " of the type" );
+      return;
+   }
+   switch( pBlock->valueType )
+   {
+      case OPT_TYPE_INT32:
+      case OPT_TYPE_INT64:
+      {
+         renderString( pRender, " [" );
+         renderSigned( pRender, pRange->min.i );
+         renderString( pRender, ", " );
+         renderSigned( pRender, pRange->max.i );
+         renderChar( pRender, ']' );
+         break;
+      }
+      case OPT_TYPE_DOUBLE:
+      {  /* Without stdio the limits of doubles can't be rendered. */
+      #ifndef CONFIG_CLOP_NO_STDIO
+         char number[32];
+         renderString( pRender, " [" );
+         snprintf( number, sizeof( number ), "%g", pRange->min.d );
+         renderString( pRender, number );
+         renderString( pRender, ", " );
+         snprintf( number, sizeof( number ), "%g", pRange->max.d );
+         renderString( pRender, number );
+         renderChar( pRender, ']' );
+      #endif
+         break;
+      }
+      default:
+      {
+         renderString( pRender, " [" );
+         renderMemory( pRender, digits, formatUnsigned( digits, pRange->min.u ) );
+         renderString( pRender, ", " );
+         renderMemory( pRender, digits, formatUnsigned( digits, pRange->max.u ) );
+         renderChar( pRender, ']' );
+         break;
+      }
+   }
+}
+#endif /* ifndef CONFIG_CLOP_NO_TYPED_VALUES */
+
+/*-----------------------------------------------------------------------------
+*/
+static void renderIndex( struct RENDER_T* pRender, int index )
+{
+   char digits[10];
+   size_t n = 0;
+   unsigned int value = (unsigned int)index;
+
+   do
+   {
+      digits[sizeof( digits ) - ++n] = '0' + (value % 10);
+      value /= 10;
+   }
+   while( value != 0 );
+   renderMemory( pRender, &digits[sizeof( digits ) - n], n );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void renderError( struct RENDER_T* pRender, const char* prgName,
+                         const struct OPTION_ERROR_T* pError )
+{
+   /* Tokens of long options are beginning with "--". */
+   const bool isLong = (pError->pToken != NULL) && (pError->pToken[0] == '-');
+   uint32_t i;
+
+   renderString( pRender, prgName );
+   renderString( pRender, ": " );
+   switch( pError->code )
+   {
+      case OPT_ERR_MISSING_OPTION:
+      {
+         renderString( pRender, "missing option -?" );
+         break;
+      }
+      case OPT_ERR_MISSING_LONG_OPTION:
+      {
+         renderString( pRender, "missing long option --???" );
+         break;
+      }
+      case OPT_ERR_UNKNOWN_LONG_OPTION:
+      {
+         renderString( pRender, "unrecognized long option " );
+         renderMemory( pRender, pError->pToken, pError->tokenLength );
+         break;
+      }
+      case OPT_ERR_AMBIGUOUS_LONG_OPTION:
+      {
+         renderString( pRender, "ambiguous long option " );
+         renderMemory( pRender, pError->pToken, pError->tokenLength );
+         renderString( pRender, ", candidates:" );
+         for( i = 0; i < pError->numOfCandidates; i++ )
+         {
+            renderString( pRender, " --" );
+            renderString( pRender, pError->ppCandidates[i]->longOpt );
+         }
+         break;
+      }
+      case OPT_ERR_UNKNOWN_SHORT_OPTION:
+      {
+         renderString( pRender, "unrecognized option -" );
+         renderChar( pRender, pError->pToken[0] );
+         break;
+      }
+      case OPT_ERR_MISSING_ARGUMENT:
+      {
+         if( isLong )
+         {
+            renderString( pRender, "missing argument of long option --" );
+            renderString( pRender, pError->pBlock->longOpt );
+            break;
+         }
+         renderString( pRender, "missing argument for option '" );
+         renderChar( pRender, pError->pToken[0] );
+         renderChar( pRender, '\'' );
+         break;
+      }
+      case OPT_ERR_MISSING_ARGUMENT_AFTER_EQUAL:
+      {
+         if( isLong )
+         {
+            renderString( pRender, "missing argument after '=' of long option --" );
+            renderString( pRender, pError->pBlock->longOpt );
+            break;
+         }
+         renderString( pRender, "missing argument after '=' of short option -" );
+         renderChar( pRender, pError->pBlock->shortOpt );
+         break;
+      }
+   #ifndef CONFIG_CLOP_NO_TYPED_VALUES
+      case OPT_ERR_INVALID_ARGUMENT:
+      case OPT_ERR_ARGUMENT_OUT_OF_RANGE:
+      {
+         renderConversionError( pRender, pError );
+         break;
+      }
+   #endif
+      case OPT_ERR_DUPLICATE_SHORT_OPTION:
+      case OPT_ERR_DUPLICATE_LONG_OPTION:
+      {
+         if( pError->code == OPT_ERR_DUPLICATE_SHORT_OPTION )
+         {
+            renderString( pRender, "short option -" );
+            renderChar( pRender, pError->pBlock->shortOpt );
+         }
+         else
+         {
+            renderString( pRender, "long option --" );
+            renderString( pRender, pError->pBlock->longOpt );
+         }
+         renderString( pRender, " of block " );
+         renderIndex( pRender, pError->argvIndex );
+         renderString( pRender, " is shadowed by block " );
+         renderIndex( pRender, pError->argvIndex -
+                               (int)(pError->pBlock - pError->pConflictBlock) );
+         break;
+      }
+      case OPT_ERR_UNREACHABLE_OPTION:
+      {
+         renderString( pRender, "option " );
+         if( pError->pToken != NULL )
+         {
+            renderString( pRender, "--" );
+            renderMemory( pRender, pError->pToken, pError->tokenLength );
+         }
+         else
+         {
+            renderChar( pRender, '-' );
+            renderChar( pRender, pError->pBlock->shortOpt );
+         }
+         renderString( pRender, " of block " );
+         renderIndex( pRender, pError->argvIndex );
+         renderString( pRender, " can't be given in a command line" );
+         break;
+      }
+      case OPT_ERR_INVALID_OPTION_BLOCK:
+      {
+         renderString( pRender, "block " );
+         renderIndex( pRender, pError->argvIndex );
+         renderChar( pRender, ' ' );
+         renderMemory( pRender, pError->pToken, pError->tokenLength );
+         break;
+      }
+      case OPT_ERR_UNKNOWN_SUBCOMMAND:
+      {
+         renderString( pRender, "unrecognized subcommand " );
+         renderMemory( pRender, pError->pToken, pError->tokenLength );
+         break;
+      }
+      case OPT_ERR_MISSING_SUBCOMMAND:
+      {
+         renderString( pRender, "missing subcommand" );
+         break;
+      }
+      case OPT_ERR_PLUGIN_NOT_LOADABLE:
+      {
+         renderString( pRender, "can't load the plugin " );
+         renderMemory( pRender, pError->pToken, pError->tokenLength );
+         break;
+      }
+      case OPT_ERR_PLUGIN_SYMBOL_NOT_FOUND:
+      {
+         renderString( pRender, "plugin symbol " );
+         renderMemory( pRender, pError->pToken, pError->tokenLength );
+         renderString( pRender, " not found" );
+         break;
+      }
+      case OPT_ERR_OUT_OF_MEMORY:
+      {
+         if( pError->pBlock == NULL )
+         {
+            renderString( pRender, "out of memory" );
+            break;
+         }
+         renderString( pRender, "out of memory for the value of option \"" );
+         renderOptionBlock( pRender, pError->pBlock );
+         renderChar( pRender, '"' );
+         break;
+      }
+      case OPT_ERR_ARGUMENT_TOO_LONG:
+      {
+         renderString( pRender, "argument in stream too long: \"" );
+         renderMemory( pRender, pError->pToken, pError->tokenLength );
+         renderString( pRender, "...\"" );
+         break;
+      }
+      case OPT_ERR_READ_FAILED:
+      {
+         renderString( pRender, "can't read argument stream" );
+         break;
+      }
+      case OPT_ERR_UNEXPECTED_NON_OPTION:
+      {
+         renderString( pRender, "unexpected non-option argument \"" );
+         renderMemory( pRender, pError->pToken, pError->tokenLength );
+         renderChar( pRender, '"' );
+         break;
+      }
+      case OPT_ERR_RESPONSE_FILE_NOT_MAPPABLE:
+      {
+         renderString( pRender, "can't map response file of argument \"" );
+         renderMemory( pRender, pError->pToken, pError->tokenLength );
+         renderChar( pRender, '"' );
+         break;
+      }
+      case OPT_ERR_RESPONSE_FILE_TOO_DEEP:
+      {
+         renderString( pRender, "response files of argument \"" );
+         renderMemory( pRender, pError->pToken, pError->tokenLength );
+         renderString( pRender, "\" nested too deeply" );
+         break;
+      }
+      default:
+      {
+         renderString( pRender, "unknown error" );
+         break;
+      }
+   }
+   renderChar( pRender, '\n' );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+size_t renderOptionError( char* pBuffer, size_t size, const char* prgName,
+                          const struct OPTION_ERROR_T* pError )
+{
+   struct RENDER_T render = { .pBuffer = pBuffer, .size = size };
+
+   renderError( &render, prgName, pError );
+   return renderTerminate( &render );
+}
+
+/*-----------------------------------------------------------------------------
+ * Records the error in the sink respectively writes its message in stderr.
+ */
+static void reportError( struct OPTION_ERROR_SINK_T* pSink, const char* prgName,
+                         const struct OPTION_ERROR_T* pError )
+{
+   if( pSink != NULL )
+   {
+      if( pSink->count < pSink->capacity )
+         pSink->pErrors[pSink->count] = *pError;
+      pSink->count++;
+      if( pSink->write != NULL )
+      {
+         char buffer[RENDER_WRITE_BUFFER_SIZE];
+         struct RENDER_T render =
+         {
+            .pBuffer = buffer,
+            .size    = sizeof( buffer ),
+            .write   = pSink->write,
+            .pHandle = pSink->pWriteHandle
+         };
+         renderError( &render, prgName, pError );
+         renderFlush( &render );
+      }
+      return;
+   }
+#ifndef CONFIG_CLOP_NO_STDIO
+   char buffer[256];
+   size_t len = renderOptionError( buffer, sizeof( buffer ), prgName, pError );
+
+   if( len >= sizeof( buffer ) )
+   {  /* Very long token. */
+      char* pBuffer = malloc( len + 1 );
+      if( pBuffer != NULL )
+      {
+         renderOptionError( pBuffer, len + 1, prgName, pError );
+         fprintf( stderr, ESC_ERROR "%s" ESC_END, pBuffer );
+         free( pBuffer );
+         return;
+      }
+   }
+   fprintf( stderr, ESC_ERROR "%s" ESC_END, buffer );
+#else
+   (void)prgName;
+#endif
+}
+
+#ifndef CONFIG_CLOP_NO_STDIO
+/*!-----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void printOption( FILE* pStream, const struct OPTION_BLOCK_T* pOptionBlock )
+{
+   char buffer[256];
+   size_t len = renderOption( buffer, sizeof( buffer ), pOptionBlock );
+
+   if( len < sizeof( buffer ) )
+   {
+      fwrite( buffer, 1, len, pStream );
+      return;
+   }
+
+   /* Very long option name. */
+   char* pBuffer = malloc( len + 1 );
+   if( pBuffer == NULL )
+      return;
+   renderOption( pBuffer, len + 1, pOptionBlock );
+   fwrite( pBuffer, 1, len, pStream );
+   free( pBuffer );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void printOptionList( FILE* pStream, struct OPTION_BLOCK_T optBlockList[] )
+{
+   char buffer[RENDER_STACK_BUFFER_SIZE];
+   struct RENDER_T render = { .pBuffer = buffer, .size = sizeof( buffer ) };
+   BLK_LIST_ITERATOR_T pBlock;
+   const char* pC;
+   char* pText;
+   size_t len;
+
+   len = renderOptionList( buffer, sizeof( buffer ), optBlockList );
+   if( len < sizeof( buffer ) )
+   {
+      fwrite( buffer, 1, len, pStream );
+      return;
+   }
+
+   pText = malloc( len + 1 );
+   if( pText != NULL )
+   {
+      renderOptionList( pText, len + 1, optBlockList );
+      fwrite( pText, 1, len, pStream );
+      free( pText );
+      return;
+   }
+
+   /* Not enough memory: writing block by block. */
+   FOR_EACH_OPTION_BLOCK( pBlock, optBlockList )
+   {
+      render.length = 0;
+      renderOptionListItem( &render, pBlock );
+      if( render.length <= render.size )
+      {
+         fwrite( buffer, 1, render.length, pStream );
+         continue;
+      }
+      fputs( "  ", pStream );
+      printOption( pStream, pBlock );
+      fputs( "\n\t", pStream );
+      for( pC = pBlock->helpText; (pC != NULL) && (*pC != '\0'); pC++ )
+      {
+         if( *pC == '\n' )
+            fputs( "\n\t", pStream );
+         else
+            fputc( *pC, pStream );
+      }
+      fputs( "\n\n", pStream );
+   }
+}
+
+/*
+ * Capacity of the handler timing report, must be a power of two.
+ * Handlers beyond it becomes counted only.
+ */
+#define TIMING_MAX_HANDLERS 256
+
+/*
+ * Maximum nesting of measured option handlers per thread, e.g. by a
+ * callback function which invokes a further parser.
+ */
+#define TIMING_MAX_NESTING 16
+
+struct TIMING_ENTRY_T
+{
+   const struct OPTION_BLOCK_T* pBlock;
+   uint64_t                     calls;
+   uint64_t                     nanoseconds;
+   uint64_t                     maxNanoseconds;
+};
+
+static struct TIMING_ENTRY_T g_timing[TIMING_MAX_HANDLERS];
+static uint64_t              g_timingDropped = 0;
+static bool                  g_timingReportRegistered = false;
+static _Thread_local uint64_t     g_timingStart[TIMING_MAX_NESTING];
+static _Thread_local unsigned int g_timingDepth = 0;
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void optionTimingPreHook( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   (void)pArg;
+   if( g_timingDepth < TIMING_MAX_NESTING )
+      g_timingStart[g_timingDepth] = monotonicNanoseconds();
+   g_timingDepth++;
+}
+
+/*-----------------------------------------------------------------------------
+ * Returns the entry of pBlock, the entries becomes claimed lock free
+ * by compare and swap.
+ */
+static struct TIMING_ENTRY_T* findTimingEntry( const struct OPTION_BLOCK_T* pBlock )
+{
+   const struct OPTION_BLOCK_T* pExpected;
+   uint32_t i = (uint32_t)(((uintptr_t)pBlock >> 4) * 2654435761U);
+   uint32_t n;
+
+   for( n = 0; n < TIMING_MAX_HANDLERS; n++, i++ )
+   {
+      i &= TIMING_MAX_HANDLERS - 1;
+      pExpected = __atomic_load_n( &g_timing[i].pBlock, __ATOMIC_ACQUIRE );
+      if( pExpected == NULL )
+      {
+         if( __atomic_compare_exchange_n( &g_timing[i].pBlock, &pExpected, pBlock,
+                                          false, __ATOMIC_ACQ_REL,
+                                          __ATOMIC_ACQUIRE ) )
+            return &g_timing[i];
+      }
+      if( pExpected == pBlock )
+         return &g_timing[i];
+   }
+   return NULL;
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void optionTimingPostHook( struct BLOCK_FUNCTION_ARG_T* pArg, int ret )
+{
+   struct TIMING_ENTRY_T* pEntry;
+   uint64_t elapsed, max;
+
+   (void)ret;
+   if( g_timingDepth == 0 )
+      return; /* Hook installed while a handler was running. */
+   g_timingDepth--;
+   if( g_timingDepth >= TIMING_MAX_NESTING )
+      return;
+   elapsed = monotonicNanoseconds() - g_timingStart[g_timingDepth];
+
+   pEntry = findTimingEntry( pArg->pCurrentBlock );
+   if( pEntry == NULL )
+   {
+      __atomic_fetch_add( &g_timingDropped, 1, __ATOMIC_RELAXED );
+      return;
+   }
+   __atomic_fetch_add( &pEntry->calls, 1, __ATOMIC_RELAXED );
+   __atomic_fetch_add( &pEntry->nanoseconds, elapsed, __ATOMIC_RELAXED );
+   max = __atomic_load_n( &pEntry->maxNanoseconds, __ATOMIC_RELAXED );
+   while( (elapsed > max) &&
+          !__atomic_compare_exchange_n( &pEntry->maxNanoseconds, &max, elapsed,
+                                        true, __ATOMIC_RELAXED,
+                                        __ATOMIC_RELAXED ) );
+}
+
+/*-----------------------------------------------------------------------------
+ * Slowest first.
+ */
+static int compareTimingEntries( const void* p1, const void* p2 )
+{
+   const struct TIMING_ENTRY_T* pEntry1 = p1;
+   const struct TIMING_ENTRY_T* pEntry2 = p2;
+
+   if( pEntry1->nanoseconds != pEntry2->nanoseconds )
+      return (pEntry1->nanoseconds < pEntry2->nanoseconds)? 1 : -1;
+   return 0;
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void printOptionTimingReport( FILE* pStream )
+{
+   struct TIMING_ENTRY_T entries[TIMING_MAX_HANDLERS];
+   char option[128];
+   size_t i, n = 0;
+   uint64_t dropped;
+
+   for( i = 0; i < TIMING_MAX_HANDLERS; i++ )
+   {
+      entries[n].pBlock = __atomic_load_n( &g_timing[i].pBlock, __ATOMIC_ACQUIRE );
+      if( entries[n].pBlock == NULL )
+         continue;
+      entries[n].calls = __atomic_load_n( &g_timing[i].calls, __ATOMIC_RELAXED );
+      entries[n].nanoseconds =
+         __atomic_load_n( &g_timing[i].nanoseconds, __ATOMIC_RELAXED );
+      entries[n].maxNanoseconds =
+         __atomic_load_n( &g_timing[i].maxNanoseconds, __ATOMIC_RELAXED );
+      n++;
+   }
+   qsort( entries, n, sizeof( struct TIMING_ENTRY_T ), compareTimingEntries );
+
+   fprintf( pStream, "Slowest option handlers:\n"
+                     "    total [ms]      calls     max [ms]  option\n" );
+   for( i = 0; i < n; i++ )
+   {
+      renderOption( option, sizeof( option ), entries[i].pBlock );
+      fprintf( pStream, "%14.3f %10llu %12.3f  %s\n",
+               entries[i].nanoseconds / 1e6,
+               (unsigned long long)entries[i].calls,
+               entries[i].maxNanoseconds / 1e6,
+               option );
+   }
+   dropped = __atomic_load_n( &g_timingDropped, __ATOMIC_RELAXED );
+   if( dropped > 0 )
+      fprintf( pStream, "%llu calls of further handlers not recorded\n",
+               (unsigned long long)dropped );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void printOptionTimingReportAtExit( void )
+{
+   printOptionTimingReport( stderr );
+}
+
+/*!----------------------------------------------------------------------------
+@see parse_opts.h
+*/
+void enableOptionTimingReport( struct OPTION_CONTEXT_T* pContext )
+{
+   pContext->preHook  = optionTimingPreHook;
+   pContext->postHook = optionTimingPostHook;
+   if( !__atomic_exchange_n( &g_timingReportRegistered, true, __ATOMIC_ACQ_REL ) )
+      atexit( printOptionTimingReportAtExit );
 }
+#endif /* ifndef CONFIG_CLOP_NO_STDIO */
 
 /*================================== EOF ====================================*/
@@ -40,7 +40,39 @@
 
 #ifndef _PARSE_ARGS_H
 #define _PARSE_ARGS_H
-#include <stdio.h>
+
+/*
+ * CONFIG_CLOP_FREESTANDING: Profile for small embedded targets without
+ * stdio, without dynamic memory and without the string functions of libc.
+ * Messages becomes written by the write function of the error sink, option
+ * tables has to be generated statically by clop-gen.
+ */
+#ifdef CONFIG_CLOP_FREESTANDING
+ #ifndef CONFIG_CLOP_NO_STDIO
+  #define CONFIG_CLOP_NO_STDIO
+ #endif
+ #ifndef CONFIG_CLOP_NO_STREAM
+  #define CONFIG_CLOP_NO_STREAM
+ #endif
+ #ifndef CONFIG_CLOP_NO_RESPONSE_FILES
+  #define CONFIG_CLOP_NO_RESPONSE_FILES
+ #endif
+ #ifndef CONFIG_CLOP_NO_THREADS
+  #define CONFIG_CLOP_NO_THREADS
+ #endif
+ #ifndef CONFIG_CLOP_NO_DLOPEN
+  #define CONFIG_CLOP_NO_DLOPEN
+ #endif
+ #ifndef CONFIG_CLOP_NO_SIMD
+  #define CONFIG_CLOP_NO_SIMD
+ #endif
+#endif
+
+#ifndef CONFIG_CLOP_NO_STDIO
+ #include <stdio.h>
+#endif
+#include <stdint.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -48,6 +80,10 @@ extern "C" {
 
 // Pre-declaration resolves the chicken-egg problem.
 struct OPTION_BLOCK_T;
+struct OPTION_TABLE_T;
+struct OPTION_CONTEXT_T;
+struct OPTION_ERROR_SINK_T;
+struct OPTION_KEYS_T;
 
 /*!
  * @brief Argument-type of the option callback function.
@@ -81,6 +117,21 @@ struct BLOCK_FUNCTION_ARG_T
                         //! The "tunnel" of your private data. \n
                         //! In this way the avoiding of global variables
                         //! becomes possible.
+
+   const struct OPTION_TABLE_T* pOptTable; //!<@brief Pointer to the compiled
+                        //! option table if the parser was invoked by
+                        //! parseCommandLineOptionsTableAt(),
+                        //! otherwise NULL.
+
+   struct OPTION_CONTEXT_T* pContext; //!<@brief Pointer to the parse context
+                        //! e.g. for the error sink, NULL if the callback
+                        //! function was not invoked by the parser.
+#ifndef CONFIG_CLOP_FREESTANDING
+   struct OPTION_ARENA_T* pArena; //!<@brief Forwarding of the arena
+                        //! OPTION_CONTEXT_T::pArena for the memory of derived
+                        //! values, see allocateFromOptionArena(). NULL if
+                        //! the parse context has no arena.
+#endif
 };
 
 /*!
@@ -96,6 +147,124 @@ struct BLOCK_FUNCTION_ARG_T
  */
 typedef int (*OPT_BLOCK_F)( struct BLOCK_FUNCTION_ARG_T* pArg );
 
+/*!
+ * @brief Signature of the write functions for texts of the library,
+ *        e.g. a UART driver of a embedded target.
+ * @see writeOptionList
+ * @see OPTION_ERROR_SINK_T
+ * @param pHandle User handle given together with the function.
+ * @param pData Text to write, not terminated.
+ * @param length Number of characters to write.
+ */
+typedef void (*OPT_WRITE_F)( void* pHandle, const char* pData, size_t length );
+
+#ifndef CONFIG_CLOP_NO_TYPED_VALUES
+/*!
+ * @brief Ready-made callback function which converts the option-argument
+ *        into the value of type OPTION_BLOCK_T::valueType and stores it
+ *        in the object of pUser at the offset OPTION_BLOCK_T::valueOffset.
+ *
+ * So the most of the numeric and flag options don't need an own callback
+ * function anymore. The conversion is independent of the locale and doesn't
+ * allocate memory. Invalid arguments, values out of the range of the type
+ * respectively of the optional struct OPTION_RANGE_T, and unknown enum
+ * names becomes reported by a uniform error message, in this case the
+ * function returns -1. \n
+ * An omitted argument of a OPTIONAL_ARG option keeps the preset value,
+ * except by OPT_TYPE_BOOL which becomes true. \n
+ * OPT_TYPE_LIST collects the arguments of all occurrences in a
+ * struct OPTION_LIST_T, its array becomes allocated from the arena
+ * OPTION_CONTEXT_T::pArena, without arena the function returns -1. \n
+ * The store kinds OPT_TYPE_SET_BIT, OPT_TYPE_SET_TRUE, OPT_TYPE_SET_FALSE,
+ * OPT_TYPE_STRING and OPT_TYPE_COUNTER need no conversion, the parser
+ * recognizes them and applies them inline without invoking the callback
+ * function. So a block-list of such options doesn't need any own code:
+ * @code
+ * struct OPTION_BLOCK_T blockList[] =
+ * {
+ *    {
+ *       .optFunction = storeOptionValue,
+ *       .shortOpt    = 'v',
+ *       .longOpt     = "verbose",
+ *       .helpText    = "Be verbose, -vv more verbose",
+ *       .valueType   = OPT_TYPE_COUNTER,
+ *       .valueOffset = offsetof( struct MY_DATA, verbosity )
+ *    },
+ *    {
+ *       .optFunction = storeOptionValue,
+ *       .shortOpt    = 'a',
+ *       .id          = 0, // Bit number
+ *       .helpText    = "Set flag 'a'",
+ *       .valueType   = OPT_TYPE_SET_BIT,
+ *       .valueOffset = offsetof( struct MY_DATA, flags )
+ *    },
+ *    {
+ *       .optFunction = storeOptionValue,
+ *       .hasArg      = OPTIONAL_ARG,
+ *       .shortOpt    = 'l',
+ *       .longOpt     = "logfile",
+ *       .helpText    = "Logfile, default: /var/log/myDefaultLogfile",
+ *       .valueType   = OPT_TYPE_STRING,
+ *       .valueOffset = offsetof( struct MY_DATA, logfileName ),
+ *       .pValueInfo  = "/var/log/myDefaultLogfile"
+ *    },
+ *    OPTION_BLOCKLIST_END_MARKER
+ * };
+ * @endcode
+ *
+ * Example:
+ * @code
+ * struct MY_DATA
+ * {
+ *    int32_t  count;
+ *    uint64_t cacheSize;
+ *    int      color;
+ * };
+ *
+ * static const struct OPTION_RANGE_T countRange = { .min.i = 1, .max.i = 100 };
+ * static const char* const colorNames[] = { "red", "green", "blue", NULL };
+ *
+ * struct OPTION_BLOCK_T blockList[] =
+ * {
+ *    {
+ *       .optFunction = storeOptionValue,
+ *       .hasArg      = REQUIRED_ARG,
+ *       .shortOpt    = 'n',
+ *       .longOpt     = "count",
+ *       .helpText    = "Number of repetitions 1 to 100",
+ *       .valueType   = OPT_TYPE_INT32,
+ *       .valueOffset = offsetof( struct MY_DATA, count ),
+ *       .pValueInfo  = &countRange
+ *    },
+ *    {
+ *       .optFunction = storeOptionValue,
+ *       .hasArg      = REQUIRED_ARG,
+ *       .longOpt     = "cache-size",
+ *       .helpText    = "Size of the cache, e.g. 64M",
+ *       .valueType   = OPT_TYPE_SIZE,
+ *       .valueOffset = offsetof( struct MY_DATA, cacheSize )
+ *    },
+ *    {
+ *       .optFunction = storeOptionValue,
+ *       .hasArg      = REQUIRED_ARG,
+ *       .longOpt     = "color",
+ *       .helpText    = "red, green or blue",
+ *       .valueType   = OPT_TYPE_ENUM,
+ *       .valueOffset = offsetof( struct MY_DATA, color ),
+ *       .pValueInfo  = colorNames
+ *    },
+ *    OPTION_BLOCKLIST_END_MARKER
+ * };
+ * @endcode
+ * @note Define CONFIG_CLOP_NO_TYPED_VALUES if you don't need it.
+ * @param pArg Pointer to the info-block of type BLOCK_FUNCTION_ARG_T,
+ *             pArg->pUser must not be NULL.
+ * @retval ==0 Value stored.
+ * @retval <0  Invalid argument.
+ */
+int storeOptionValue( struct BLOCK_FUNCTION_ARG_T* pArg );
+#endif /* ifndef CONFIG_CLOP_NO_TYPED_VALUES */
+
 /*!
  * @brief Helper-macro for OPT_LAMBDA. Makes anonymous functions for C possible.
  * @see OPT_LAMBDA
@@ -161,6 +330,93 @@ typedef enum
 #endif
 } ARG_REQUIRE_T;
 
+#ifndef CONFIG_CLOP_NO_TYPED_VALUES
+/*!
+ * @brief Type of the value which becomes converted from the option-argument
+ *        and stored by storeOptionValue().
+ * @see storeOptionValue
+ */
+typedef enum
+{
+   OPT_TYPE_NONE   = 0, //!<@brief No typed value, default.
+   OPT_TYPE_INT32,      //!<@brief int32_t, decimal or hexadecimal "0x..." with
+                        //!        optional sign.
+   OPT_TYPE_INT64,      //!<@brief int64_t, like OPT_TYPE_INT32.
+   OPT_TYPE_UINT64,     //!<@brief uint64_t, decimal or hexadecimal "0x...".
+   OPT_TYPE_DOUBLE,     //!<@brief double, "[+-]digits[.digits][(e|E)[+-]digits]"
+                        //!        always with '.' independent of the locale.
+   OPT_TYPE_SIZE,       //!<@brief uint64_t, like OPT_TYPE_UINT64 with an optional
+                        //!        binary suffix K, M, G, T, P or E (case
+                        //!        insensitive) optional followed by "iB" or "B",
+                        //!        e.g. "4k" = 4096, "2MiB" = 2097152.
+   OPT_TYPE_BOOL,       //!<@brief bool, "1", "0", "true", "false", "yes", "no",
+                        //!        "on" or "off", without argument true.
+   OPT_TYPE_ENUM,       //!<@brief int, index of the argument in the by NULL
+                        //!        terminated name array of pValueInfo.
+   /* Store kinds without conversion, applied inline by the parser: */
+   OPT_TYPE_SET_BIT,    //!<@brief unsigned int, sets the bit number
+                        //!        OPTION_BLOCK_T::id.
+   OPT_TYPE_SET_TRUE,   //!<@brief bool, becomes true.
+   OPT_TYPE_SET_FALSE,  //!<@brief bool, becomes false.
+   OPT_TYPE_STRING,     //!<@brief const char*, pointer to the option-argument,
+                        //!        respectively to the optional default string
+                        //!        in pValueInfo if the argument has been omitted.
+   OPT_TYPE_COUNTER     //!<@brief int, becomes incremented by each occurrence,
+                        //!        e.g. "-vvv" = 3.
+#ifndef CONFIG_CLOP_FREESTANDING
+   ,
+   OPT_TYPE_LIST        //!<@brief struct OPTION_LIST_T, each occurrence appends
+                        //!        the option-argument respectively the optional
+                        //!        default string in pValueInfo, e.g.
+                        //!        "-I dir1 -I dir2". Needs the arena
+                        //!        OPTION_CONTEXT_T::pArena.
+#endif
+} OPT_VALUE_TYPE_T;
+
+/*!
+ * @brief Optional range of a numeric typed value, the member of the union
+ *        depends on the type: i for OPT_TYPE_INT32 and OPT_TYPE_INT64,
+ *        u for OPT_TYPE_UINT64 and OPT_TYPE_SIZE and d for OPT_TYPE_DOUBLE.
+ *
+ * Example:
+ * @code
+ * static const struct OPTION_RANGE_T portRange = { .min.u = 1, .max.u = 65535 };
+ * @endcode
+ */
+struct OPTION_RANGE_T
+{
+   union
+   {
+      int64_t  i;
+      uint64_t u;
+      double   d;
+   } min,  //!<@brief Smallest allowed value.
+     max;  //!<@brief Greatest allowed value.
+};
+
+#ifndef CONFIG_CLOP_FREESTANDING
+/*!
+ * @brief Value of OPT_TYPE_LIST: all option-arguments of a repeated option
+ *        in a contiguous array in the arena of the parse context.
+ *
+ * The items are pointers into ppArgv[], the strings becomes not copied.
+ * Initialize it by zero, further parse calls with the same arena append
+ * their items. The array becomes released together with the arena by
+ * releaseOptionArena().
+ * @see OPTION_CONTEXT_T::countLists
+ */
+struct OPTION_LIST_T
+{
+   const char** ppItems;  //!<@brief Array of the option-arguments in the
+                          //!        order of the command line, NULL as long
+                          //!        as the list is empty.
+   size_t       count;    //!<@brief Number of items in ppItems[].
+   size_t       capacity; //!<@brief Private.
+   size_t       needed;   //!<@brief Private.
+};
+#endif
+#endif /* ifndef CONFIG_CLOP_NO_TYPED_VALUES */
+
 /*!
  * @brief Definition of the option-block.
  */
@@ -185,6 +441,21 @@ struct OPTION_BLOCK_T
    const char*   helpText;    //!<@brief Additional help-text for your option. \n
                               //!        You can omit this in your initializer,
                               //!        but that's not a good idea. ;-)
+#ifndef CONFIG_CLOP_NO_TYPED_VALUES
+   OPT_VALUE_TYPE_T valueType; //!<@brief Type of the value which becomes stored
+                              //!        by storeOptionValue(). \n
+                              //!        Omit it for your own callback functions.
+
+   size_t        valueOffset; //!<@brief Offset of the value in the object of
+                              //!        pUser, use offsetof(). \n
+                              //!        Only for storeOptionValue().
+
+   const void*   pValueInfo;  //!<@brief Optional pointer to a
+                              //!        struct OPTION_RANGE_T for numeric
+                              //!        types, respectively mandatory pointer to
+                              //!        the by NULL terminated name array
+                              //!        (const char* const[]) for OPT_TYPE_ENUM.
+#endif
 };
 
 /*!
@@ -384,52 +655,1560 @@ static inline int parseCommandLineOptions( int argc,
 }
 
 /*!
- * @brief Prints the schort option (if present) and long option
- *        (if present) of a option-block in the file pStream.
+ * @brief Initial value of the 32 bit FNV-1a hash of the long option names.
+ * @see optionNameHash
+ */
+#define OPTION_HASH_INIT 2166136261U
+
+/*!
+ * @brief Single step of the 32 bit FNV-1a hash of the long option names.
+ * @param h Current hash value.
+ * @param c Next character of the option name.
+ */
+#define OPTION_HASH_STEP( h, c ) ((uint32_t)(((h) ^ (uint8_t)(c)) * 16777619U))
+
+/*!
+ * @brief Hash function for long option names used by the compiled
+ *        option tables and by the code generator clop-gen.
+ * @param pName Pointer to the name, doesn't need to be zero terminated.
+ * @param len Length of the name.
+ * @return Hash value.
+ */
+static inline uint32_t optionNameHash( const char* pName, size_t len )
+{
+   uint32_t hash = OPTION_HASH_INIT;
+   while( len-- > 0 )
+      hash = OPTION_HASH_STEP( hash, *pName++ );
+   return hash;
+}
+
+/*!
+ * @brief Secondary hash function of the perfect hash index made by
+ *        the code generator clop-gen.
+ * @param hash Value of optionNameHash().
+ * @param seed Seed value of the bucket of the hash value.
+ * @return Hash value.
+ */
+static inline uint32_t optionSeedHash( uint32_t hash, uint32_t seed )
+{
+   hash ^= seed;
+   hash ^= hash >> 16;
+   hash *= 0x85EBCA6BU;
+   hash ^= hash >> 13;
+   hash *= 0xC2B2AE35U;
+   hash ^= hash >> 16;
+   return hash;
+}
+
+/*!
+ * @brief Element of the hash index of a compiled option table.
+ * @note This is a internal data type of OPTION_TABLE_T.
+ */
+struct OPTION_HASH_SLOT_T
+{
+   uint32_t hash;    //!<@brief Hash value of the long option name.
+   uint32_t index;   //!<@brief Index of the option block + 1, 0 if
+                     //!        this slot is empty.
+};
+
+/*!
+ * @brief Compiled option table.
+ *
+ * A compiled option table contains besides the pointer to your option
+ * block-list a hash index over the long option names and a direct
+ * dispatch table for the short options, so that the
+ * parser function parseCommandLineOptionsTableAt() can find each long option
+ * in constant average time and each short option by a single indexed
+ * access instead of browsing the whole block-list. \n
+ * That's worthwhile for large block-lists and/or long command lines.
+ *
+ * The fields of the option blocks which the lookups need are held as
+ * structure of arrays: packed arrays of the short option characters, the
+ * hash values and lengths of the long names, indexed like the block-list,
+ * and one contiguous pool of all long names. A lookup touches the option
+ * block only when the option has been found, so the hot data of a table
+ * of 10000 options stays in the level 2 cache.
+ *
+ * The table becomes build once by initOptionTable() and is not modified
+ * by the parser. \n
+ * Alternatively the code generator clop-gen (see tools/clop-gen) emits a
+ * statically initialized table with a minimal perfect hash index from a
+ * option description file, so that no index has to be build at the program
+ * start.
+ * @note All members are private, use the functions initOptionTable()
+ *       and freeOptionTable() only.
+ */
+struct OPTION_TABLE_T
+{
+   struct OPTION_BLOCK_T*           pOptBlockList; //!<@brief Start-pointer of the
+                                                   //!        option block-list.
+   const struct OPTION_HASH_SLOT_T* pSlots;        //!<@brief Hash index of the
+                                                   //!        long options.
+   uint32_t                         slotMask;      //!<@brief Number of slots - 1.
+   uint32_t                         numOfSlots;    //!<@brief Number of slots.
+   const uint32_t*                  pSeeds;        //!<@brief Bucket seeds of a perfect
+                                                   //! hash index made by clop-gen,
+                                                   //! NULL by initOptionTable().
+   uint32_t                         seedMask;      //!<@brief Number of seeds - 1.
+   uint32_t                         numOfBlocks;   //!<@brief Number of option blocks
+                                                   //!        without end marker.
+   const char*                      pShortOpts;    //!<@brief Short option per block,
+                                                   //!        0 if not used.
+   const uint32_t*                  pHashes;       //!<@brief Hash value of the long
+                                                   //!        option per block.
+   const uint32_t*                  pLengths;      //!<@brief Length of the long option
+                                                   //! per block, 0 if not used.
+   const uint32_t*                  pNameOffsets;  //!<@brief Offset of the long option
+                                                   //! in pNamePool per block.
+   const char*                      pNamePool;     //!<@brief All long option names,
+                                                   //! each one terminated by '\0'.
+   const struct OPTION_BLOCK_T*     shortOptIndex[256]; //!<@brief Dispatch table
+                                                   //! for the short options, index is
+                                                   //! the character as unsigned char.
+   const struct OPTION_BLOCK_T* const* ppPrefixIndex; //!<@brief Long options sorted
+                                                   //! by name for the unique-prefix
+                                                   //! matching, NULL if disabled.
+                                                   //! @see enableOptionPrefixMatching
+   uint32_t                         numOfPrefixes; //!<@brief Number of elements in
+                                                   //!        ppPrefixIndex[].
+};
+
+#ifndef CONFIG_CLOP_FREESTANDING
+/*!
+ * @brief Builds the compiled option table of your option block-list.
  *
- * Helper-function can be used to simplify e.g. your print-help-function
- * and/or error messages in your callback-functions. \n
  * Example:
  * @code
- * static int optOneOfMyCallbackFunctions( struct BLOCK_FUNCTION_ARG_T* pArg )
+ * struct OPTION_TABLE_T optTable;
+ *
+ * if( initOptionTable( &optTable, blockList ) < 0 )
+ *    return EXIT_FAILURE;
+ *
+ * for( i = 1; i < argc; i++ )
  * {
- *   //... do something ...
- *   if( something_was_wrong )
- *   {
- *      fprintf( stderr, "Error in option: \"" );
- *      printOption( stderr, pArg->pCurrentBlock );
- *      fprintf( stderr "\" bla bla bla :-(\n" );
- *      return -1;
- *   }
- *   return 0;
+ *    i = parseCommandLineOptionsTableAt( i, argc, ppArgv, &optTable, &myData );
+ *    if( i < 0 )
+ *       break;
+ *    if( i < argc )
+ *       printf( "Non option argument in ppArgv[%d]: \"%s\"\n", i, ppArgv[i] );
  * }
+ *
+ * freeOptionTable( &optTable );
  * @endcode
- * @param pStream Output-file e.g. stdout or stderr.
- * @param pOptionBlock Pointer to the option-block.
+ *
+ * The block-list becomes checked once by validateOptionBlockList(), the
+ * findings becomes reported in stderr, use initOptionTableWithSink() to
+ * collect them instead. If a long option name or a short option character
+ * is defined more than once in the block-list, so the first one wins, like
+ * in parseCommandLineOptionsAt().
+ *
+ * @note The block-list must be valid as long as the table is in use.
+ * @param pTable Pointer to the table object to initialize.
+ * @param optBlockList Pointer to your defined option-block-list.
+ * @retval ==0 Success.
+ * @retval >0  Number of findings of validateOptionBlockList(), the table is
+ *             usable nevertheless and has to be released by
+ *             freeOptionTable().
+ * @retval <0  Not enough memory.
  */
-void printOption( FILE* pStream, const struct OPTION_BLOCK_T* pOptionBlock );
+int initOptionTable( struct OPTION_TABLE_T* pTable,
+                     struct OPTION_BLOCK_T optBlockList[] );
 
 /*!
- * @brief Prints the formatted content of each element of your option-block-list
- *        in the file pStream.
+ * @brief Like initOptionTable(), but the findings of
+ *        validateOptionBlockList() becomes reported in the error sink.
+ *
+ * parseSubcommandLine() compiles the tables of the subcommands by this
+ * function with the error sink of its parse context.
+ * @param pTable Pointer to the table object to initialize.
+ * @param optBlockList Pointer to your defined option-block-list.
+ * @param pSink Optional error sink, if NULL the findings becomes reported
+ *              in stderr.
+ * @retval ==0 Success.
+ * @retval >0  Number of findings, the table has to be released by
+ *             freeOptionTable() nevertheless.
+ * @retval <0  Not enough memory.
+ */
+int initOptionTableWithSink( struct OPTION_TABLE_T* pTable,
+                             struct OPTION_BLOCK_T optBlockList[],
+                             struct OPTION_ERROR_SINK_T* pSink );
+
+/*!
+ * @brief Releases the memory of a compiled option table which has been
+ *        allocated by initOptionTable() and enableOptionPrefixMatching().
+ * @param pTable Pointer to the table object.
+ */
+void freeOptionTable( struct OPTION_TABLE_T* pTable );
+
+/*!
+ * @brief Enables the matching of unique prefixes of long options like
+ *        GNU getopt_long(), e.g. "--verb" for "--verbose".
+ *
+ * Builds a by name sorted index of the long options of the table.
+ * A name which doesn't match exactly becomes searched in this index by
+ * binary search. When the name is the prefix of exact one long option, so
+ * this option becomes taken. When it's the prefix of more than one option,
+ * so all candidates becomes reported in a single error message and
+ * the option is handled like a unrecognized option. \n
+ * The index of a table made by clop-gen becomes generated by its option
+ * --unique-prefixes.
+ * @note Only for the parser functions which using a compiled option table.
+ * @param pTable Pointer to the table object made by initOptionTable().
+ * @retval ==0 Success.
+ * @retval <0  Not enough memory.
+ */
+int enableOptionPrefixMatching( struct OPTION_TABLE_T* pTable );
+#endif /* ifndef CONFIG_CLOP_FREESTANDING */
+
+/*!
+ * @brief The option command line parser for the mixed order of
+ *        non-option arguments and option arguments by using a compiled
+ *        option table.
+ *
+ * Works exactly like parseCommandLineOptionsAt() but the options becomes
+ * searched in the index of the compiled option table.
+ * @see initOptionTable
+ * @see parseCommandLineOptionsAt
+ * @param offset Start-offset, initializer of the index for ppArgv[].
+ * @param argc The first argument of your main() function.
+ * @param ppArgv Argument vector the second argument of your main() function.
+ * @param pTable Pointer to the compiled option table, made by
+ *               initOptionTable().
+ * @param pUser Optional pointer to your data structure.
+ * @retval <0 Parsing was not successful.
+ * @retval >0 Index-value to the first non-option argument after
+ *            possible options if present.
+ */
+int parseCommandLineOptionsTableAt( int offset,
+                                    int argc,
+                                    char* const ppAgv[],
+                                    const struct OPTION_TABLE_T* pTable,
+                                    void* pUser
+                                  );
+
+/*!
+ * @brief The option command line parser for the classical order by
+ *        using a compiled option table.
+ * @see parseCommandLineOptionsTableAt
+ * @see parseCommandLineOptions
+ * @param argc The first argument of your main() function.
+ * @param ppArgv Argument vector the second argument of your main() function.
+ * @param pTable Pointer to the compiled option table, made by
+ *               initOptionTable().
+ * @param pUser Optional pointer to your data structure.
+ * @retval <0 Parsing was not successful.
+ * @retval >0 Index-value to the first non-option argument if present.
+ */
+static inline int parseCommandLineOptionsTable( int argc,
+                                                char* const ppAgv[],
+                                                const struct OPTION_TABLE_T* pTable,
+                                                void* pUser
+                                              )
+{
+   return parseCommandLineOptionsTableAt( 1, argc, ppAgv, pTable, pUser );
+}
+
+/*!
+ * @brief Error codes of the error records.
+ * @see OPTION_ERROR_T
+ */
+typedef enum
+{
+   OPT_ERR_MISSING_OPTION,         //!<@brief Single '-' without option character.
+   OPT_ERR_MISSING_LONG_OPTION,    //!<@brief "--" without option name.
+   OPT_ERR_UNKNOWN_LONG_OPTION,    //!<@brief Unrecognized long option.
+   OPT_ERR_AMBIGUOUS_LONG_OPTION,  //!<@brief Prefix of more than one long option.
+   OPT_ERR_UNKNOWN_SHORT_OPTION,   //!<@brief Unrecognized short option.
+   OPT_ERR_MISSING_ARGUMENT,       //!<@brief Missing argument of a REQUIRED_ARG
+                                   //!        option.
+   OPT_ERR_MISSING_ARGUMENT_AFTER_EQUAL, //!<@brief Missing argument after '='
+                                   //!        of a OPTIONAL_ARG option.
+   OPT_ERR_INVALID_ARGUMENT,       //!<@brief Argument can't be converted by
+                                   //!        storeOptionValue().
+   OPT_ERR_ARGUMENT_OUT_OF_RANGE,  //!<@brief Argument out of range by
+                                   //!        storeOptionValue().
+   OPT_ERR_DUPLICATE_SHORT_OPTION, //!<@brief Block-list: short option is
+                                   //!        shadowed by pConflictBlock.
+   OPT_ERR_DUPLICATE_LONG_OPTION,  //!<@brief Block-list: long option is
+                                   //!        shadowed by pConflictBlock.
+   OPT_ERR_UNREACHABLE_OPTION,     //!<@brief Block-list: option name which can't
+                                   //!        be given in a command line.
+   OPT_ERR_INVALID_OPTION_BLOCK,   //!<@brief Block-list: defective block, pToken
+                                   //!        describes the defect.
+   OPT_ERR_UNKNOWN_SUBCOMMAND,     //!<@brief Unrecognized subcommand, pToken
+                                   //!        is its name.
+   OPT_ERR_MISSING_SUBCOMMAND,     //!<@brief Command needs a subcommand but
+                                   //!        the command line ends.
+   OPT_ERR_PLUGIN_NOT_LOADABLE,    //!<@brief Shared object of a subcommand
+                                   //!        can't be loaded, pToken is its
+                                   //!        path.
+   OPT_ERR_PLUGIN_SYMBOL_NOT_FOUND, //!<@brief Shared object of a subcommand
+                                   //!        doesn't define the symbol pToken.
+   OPT_ERR_OUT_OF_MEMORY,          //!<@brief Not enough memory, if pBlock
+                                   //!        isn't NULL its value can't be
+                                   //!        stored because the arena of the
+                                   //!        parse context is missing or
+                                   //!        exhausted.
+   OPT_ERR_ARGUMENT_TOO_LONG,      //!<@brief Argument of a argument stream
+                                   //!        doesn't fit in its buffer, pToken
+                                   //!        is its begin.
+   OPT_ERR_READ_FAILED,            //!<@brief The reader function of a
+                                   //!        argument stream has failed.
+   OPT_ERR_UNEXPECTED_NON_OPTION,  //!<@brief Non-option argument pToken in
+                                   //!        a argument stream without
+                                   //!        OPTION_STREAM_T::nonOptionFunction.
+   OPT_ERR_RESPONSE_FILE_NOT_MAPPABLE, //!<@brief The response file of the
+                                   //!        argument pToken respectively a
+                                   //!        nested one can't be mapped.
+   OPT_ERR_RESPONSE_FILE_TOO_DEEP  //!<@brief The response files of the
+                                   //!        argument pToken are nested too
+                                   //!        deeply, e.g. by a cycle.
+} OPT_ERROR_CODE_T;
+
+/*!
+ * @brief Error record of the error sink, filled without any formatting.
+ * @see OPTION_ERROR_SINK_T
+ * @see validateOptionBlockList
+ */
+struct OPTION_ERROR_T
+{
+   OPT_ERROR_CODE_T code;       //!<@brief Kind of the error.
+   int          argvIndex;      //!<@brief Index of the concerned argument in ppArgv[],
+                                //!        by the errors of validateOptionBlockList()
+                                //!        the index of pBlock in the block-list.
+   const char*  pToken;         //!<@brief Offending token in ppArgv[argvIndex],
+                                //!        not necessarily terminated at tokenLength.
+   size_t       tokenLength;    //!<@brief Length of the offending token.
+   const struct OPTION_BLOCK_T* pBlock; //!<@brief Concerned option block or NULL.
+   const struct OPTION_BLOCK_T* const* ppCandidates; //!<@brief Candidates of
+                                //!        OPT_ERR_AMBIGUOUS_LONG_OPTION, points
+                                //!        into the index of the option table.
+   uint32_t     numOfCandidates; //!<@brief Number of elements in ppCandidates[].
+   const struct OPTION_BLOCK_T* pConflictBlock; //!<@brief Block of the same
+                                //!        block-list which shadows pBlock.
+};
+
+/*!
+ * @brief Error sink: caller-provided array of fixed capacity which collects
+ *        the errors instead of messages in stderr.
+ *
+ * The records becomes filled without formatting, the text rendering by
+ * renderOptionError() is deferred and optional. So the parsing of untrusted
+ * command lines at high rate doesn't depend on stdio. \n
+ * Without stdio (CONFIG_CLOP_NO_STDIO, CONFIG_CLOP_FREESTANDING) the write
+ * function is the only way to get the messages in text form.
+ * @see OPTION_CONTEXT_T
+ */
+struct OPTION_ERROR_SINK_T
+{
+   struct OPTION_ERROR_T* pErrors;  //!<@brief Array of error records.
+   size_t                 capacity; //!<@brief Number of elements in pErrors[].
+   size_t                 count;    //!<@brief Number of occurred errors, set it
+                                    //!        to zero before parsing. \n
+                                    //!        When it's greater than capacity,
+                                    //!        so the surplus errors has been
+                                    //!        counted only.
+   OPT_WRITE_F            write;    //!<@brief Optional write function, when given
+                                    //!        each error becomes rendered by
+                                    //!        renderOptionError() and written
+                                    //!        by it as well.
+   void*                  pWriteHandle; //!<@brief Handle for write.
+};
+
+#ifndef CONFIG_CLOP_FREESTANDING
+/*!
+ * @brief Checks the shape of a option block-list once, so the parser
+ *        doesn't need any checks per argument.
+ *
+ * Detects in O(M log M):
+ * - duplicate short and long option names, the later block is shadowed
+ *   because the first one wins,
+ * - names which can't be given in a command line, e.g. the short option '-'
+ *   or a long option containing '=',
+ * - defective blocks without option name, with a argument kind which is
+ *   excluded by CONFIG_CLOP_NO_*, or with a invalid value type of
+ *   storeOptionValue().
+ *
+ * Each finding becomes reported as error record in the sink, or as message
+ * in stderr if pSink is NULL. initOptionTable() invokes this function, for
+ * block-lists without a compiled table call it e.g. in your debug build or
+ * in a unit test. clop-gen checks its description files in the same way.
+ * @param optBlockList Your option-block-list.
+ * @param pSink Optional error sink.
+ * @retval ==0 The block-list is all right.
+ * @retval >0  Number of findings.
+ * @retval <0  Not enough memory.
+ */
+int validateOptionBlockList( struct OPTION_BLOCK_T optBlockList[],
+                             struct OPTION_ERROR_SINK_T* pSink );
+#endif
+
+#ifdef CONFIG_CLOP_STATISTICS
+/*!
+ * @brief Counters of a single option block.
+ * @see OPTION_STATISTICS_T
+ */
+struct OPTION_BLOCK_STATISTIC_T
+{
+   uint64_t hits;        //!<@brief Number of occurrences of the option.
+   uint64_t nanoseconds; //!<@brief Cumulative time of its callback function
+                         //!        respectively of the inline storing.
+};
+
+/*!
+ * @brief Instrumentation of the parser, enabled by the compile switch
+ *        CONFIG_CLOP_STATISTICS.
+ *
+ * Records the usage of each option block, the time of its callback function
+ * and the cost of the option lookup. The counters becomes incremented by
+ * relaxed atomic operations without any lock, so one statistics object can
+ * be shared by parallel parsing threads, e.g. of parseCommandLineBatch().
+ * The memory is provided by the caller, nothing becomes allocated. \n
+ * Without the compile switch neither the objects nor any code of it exists.
  *
- * Helper-function can be used to simplify your print-help-function. \n
  * Example:
  * @code
- * static int optPrintMyHelp( struct BLOCK_FUNCTION_ARG_T* pArg )
+ * static struct OPTION_BLOCK_STATISTIC_T
+ *    blockStatistics[sizeof( blockList ) / sizeof( blockList[0] )];
+ * static struct OPTION_STATISTICS_T statistics;
+ *
+ * initOptionStatistics( &statistics, blockStatistics, blockList );
+ * setOptionStatistics( &statistics );
+ * ...
+ * writeOptionStatistics( myWrite, myHandle, &statistics, OPT_STAT_JSON );
+ * @endcode
+ * @see initOptionStatistics
+ * @see setOptionStatistics
+ * @see renderOptionStatistics
+ */
+struct OPTION_STATISTICS_T
+{
+   struct OPTION_BLOCK_T*           pOptBlockList; //!<@brief Observed block-list,
+                                                   //!        the index of a block
+                                                   //!        is the index in pBlocks[].
+   struct OPTION_BLOCK_STATISTIC_T* pBlocks;       //!<@brief Counters of the blocks.
+   size_t                           numOfBlocks;   //!<@brief Number of elements in
+                                                   //!        pBlocks[].
+   uint64_t (*getNanoseconds)( void );             //!<@brief Optional monotonic clock,
+                                                   //!        when NULL so
+                                                   //!        CLOCK_MONOTONIC becomes
+                                                   //!        used respectively no time
+                                                   //!        becomes measured by
+                                                   //!        CONFIG_CLOP_FREESTANDING.
+   uint64_t                         parses;        //!<@brief Number of parser runs.
+   uint64_t                         lookups;       //!<@brief Number of searched
+                                                   //!        options.
+   uint64_t                         unknown;       //!<@brief Number of unrecognized
+                                                   //!        or ambiguous options.
+   uint64_t                         lookupNanoseconds; //!<@brief Cumulative time of
+                                                   //!        the option lookup and
+                                                   //!        argument scanning without
+                                                   //!        the callbacks.
+};
+
+/*!
+ * @brief Formats of the statistics export.
+ * @see renderOptionStatistics
+ */
+typedef enum
+{
+   OPT_STAT_JSON,  //!<@brief JSON object with the names of the options.
+   OPT_STAT_BINARY //!<@brief Compact record, all numbers little endian: \n
+                   //!        "CLST", uint32 version (1), uint32 numOfBlocks,
+                   //!        uint64 parses, lookups, unknown,
+                   //!        lookupNanoseconds, followed by uint64 hits and
+                   //!        nanoseconds of each block in order of the
+                   //!        block-list.
+} OPT_STAT_FORMAT_T;
+
+/*!
+ * @brief Initializes a statistics object for the given block-list with
+ *        zero counters.
+ * @param pStatistics Pointer to the statistics object.
+ * @param pBlocks Array with at least so many elements as blocks in
+ *                optBlockList, e.g.
+ *                sizeof( blockList ) / sizeof( blockList[0] ).
+ * @param optBlockList The observed option-block-list, for compiled tables
+ *                     its pOptBlockList.
+ */
+void initOptionStatistics( struct OPTION_STATISTICS_T* pStatistics,
+                           struct OPTION_BLOCK_STATISTIC_T pBlocks[],
+                           struct OPTION_BLOCK_T optBlockList[] );
+
+/*!
+ * @brief Sets the process wide statistics object of all parser functions
+ *        whose parse context has no own statistics object, inclusive
+ *        parseCommandLineOptionsAt() and parseCommandLineBatch().
+ * @note Set it before the parsing begins, NULL disables the recording.
+ * @param pStatistics Pointer to the statistics object or NULL.
+ */
+void setOptionStatistics( struct OPTION_STATISTICS_T* pStatistics );
+
+/*!
+ * @brief Renders the statistics in JSON or in the compact binary format.
+ *
+ * Works like snprintf(): the return value is the length of the whole record,
+ * so a return value >= size means it has been truncated. A JSON text becomes
+ * zero terminated, the binary record has no terminator.
+ * @param pBuffer Target buffer, can be NULL if size is 0.
+ * @param size Size of the buffer.
+ * @param pStatistics Pointer to the statistics object.
+ * @param format OPT_STAT_JSON or OPT_STAT_BINARY.
+ * @return Length of the record without a terminating zero.
+ */
+size_t renderOptionStatistics( char* pBuffer, size_t size,
+                               const struct OPTION_STATISTICS_T* pStatistics,
+                               OPT_STAT_FORMAT_T format );
+
+/*!
+ * @brief Writes the statistics like renderOptionStatistics() by your
+ *        write function, without allocation of memory.
+ * @param write Your write function.
+ * @param pHandle Handle for your write function.
+ * @param pStatistics Pointer to the statistics object.
+ * @param format OPT_STAT_JSON or OPT_STAT_BINARY.
+ */
+void writeOptionStatistics( OPT_WRITE_F write, void* pHandle,
+                            const struct OPTION_STATISTICS_T* pStatistics,
+                            OPT_STAT_FORMAT_T format );
+#endif /* ifdef CONFIG_CLOP_STATISTICS */
+
+/*!
+ * @brief Hook function which becomes invoked before each option handler.
+ *
+ * An option handler is the callback function of the option block
+ * respectively the inline storing of storeOptionValue().
+ * @see OPTION_CONTEXT_T
+ * @param pArg Argument of the following callback function, pArg->pContext
+ *             points to the parse context, so the hook can reach its data
+ *             by pArg->pContext->pHookData.
+ */
+typedef void (*OPT_PRE_HOOK_F)( struct BLOCK_FUNCTION_ARG_T* pArg );
+
+/*!
+ * @brief Hook function which becomes invoked after each option handler.
+ * @see OPT_PRE_HOOK_F
+ * @param pArg Argument of the preceding callback function.
+ * @param ret Return value of the callback function.
+ */
+typedef void (*OPT_POST_HOOK_F)( struct BLOCK_FUNCTION_ARG_T* pArg, int ret );
+
+#ifndef CONFIG_CLOP_FREESTANDING
+struct OPTION_ARENA_CHUNK_T;
+
+/*!
+ * @brief Arena of a parse context: memory which the parser and the callback
+ *        functions allocate piecewise in larger chunks and which becomes
+ *        released at once.
+ *
+ * Initialize it by zero, optionally with a own chunk size. It can be used
+ * for several parse calls, all of its memory lives until
+ * releaseOptionArena() respectively resetOptionArena().
+ * @code
+ * struct OPTION_ARENA_T arena = { .chunkSize = 64 * 1024 };
+ * @endcode
+ * @see OPTION_CONTEXT_T::pArena
+ * @see BLOCK_FUNCTION_ARG_T::pArena
+ */
+struct OPTION_ARENA_T
+{
+   struct OPTION_ARENA_CHUNK_T* pChunks; //!<@brief Private, the chunk of the
+                                         //!        next allocation first.
+   size_t chunkSize; //!<@brief Size of the chunks in bytes, 0 for 4 KiB.
+                     //!        A allocation larger than a quarter of it
+                     //!        gets an own chunk.
+};
+
+/*!
+ * @brief Allocates memory from the arena, e.g. for values derived from
+ *        a option-argument within a callback function.
+ *
+ * The memory is aligned like by malloc() and can't be released
+ * individually.
+ * @code
+ * static int optDefine( struct BLOCK_FUNCTION_ARG_T* pArg )
  * {
- *    printf( "Bla bla bla ...\n" );
- *    printf( "Usage: %s [options] bla bla bla...\n". pArg->ppAgv[0] );
- *    printf( "Options:\n" );
- *    printOptionList( stdout, pArg->pOptBlockList );
- *    exit( EXIT_SUCCESS );
- *    return 0;
+ *    struct KEY_VALUE_T* pPair =
+ *       allocateFromOptionArena( pArg->pArena, sizeof( struct KEY_VALUE_T ) );
+ *    if( pPair == NULL )
+ *       return -1;
+ *    ...
  * }
  * @endcode
- * @param pStream Output-file e.g. stdout or stderr.
- * @param optBlockList Start-pointer to your option-block-list.
+ * @param pArena Pointer to the arena, can be NULL.
+ * @param size Number of bytes.
+ * @return Pointer to the memory, NULL if pArena is NULL or the memory
+ *         is exhausted.
  */
-void printOptionList( FILE* pStream, struct OPTION_BLOCK_T optBlockList[] );
+void* allocateFromOptionArena( struct OPTION_ARENA_T* pArena, size_t size );
+
+/*!
+ * @brief Releases all memory of the arena at once, e.g. the arrays of the
+ *        struct OPTION_LIST_T values. Afterwards the arena is empty and
+ *        can be used again.
+ * @param pArena Pointer to the arena.
+ */
+void releaseOptionArena( struct OPTION_ARENA_T* pArena );
+
+/*!
+ * @brief Releases all memory of the arena at once like releaseOptionArena(),
+ *        but keeps one chunk for the next parse call.
+ *
+ * So a long-lived process which parses repeatedly doesn't call the
+ * allocator anymore, as long as the values of a parse call fit in a
+ * single chunk.
+ * @param pArena Pointer to the arena.
+ */
+void resetOptionArena( struct OPTION_ARENA_T* pArena );
+#endif /* ifndef CONFIG_CLOP_FREESTANDING */
+
+/*!
+ * @brief Parse context for parseCommandLineContextAt().
+ *
+ * Bundles the option block-list respectively the compiled table with the
+ * optional services of the parser, so further services doesn't need
+ * further parser functions. Members which are not used has to be NULL,
+ * so initialize it by a designated initializer.
+ */
+struct OPTION_CONTEXT_T
+{
+   struct OPTION_BLOCK_T*       pOptBlockList; //!<@brief Your option-block-list,
+                                               //!        ignored if pTable is given.
+   const struct OPTION_TABLE_T* pTable;        //!<@brief Optional compiled option
+                                               //!        table.
+   struct OPTION_ERROR_SINK_T*  pErrorSink;    //!<@brief Optional error sink,
+                                               //!        if NULL the errors becomes
+                                               //!        reported in stderr.
+   void*                        pUser;         //!<@brief Optional pointer to your
+                                               //!        data structure.
+#ifdef CONFIG_CLOP_STATISTICS
+   struct OPTION_STATISTICS_T*  pStatistics;   //!<@brief Optional statistics
+                                               //!        object, if NULL the one of
+                                               //!        setOptionStatistics().
+#endif
+   OPT_PRE_HOOK_F               preHook;       //!<@brief Optional hook before each
+                                               //!        option handler, e.g. for
+                                               //!        timers or trace points.
+   OPT_POST_HOOK_F              postHook;      //!<@brief Optional hook after each
+                                               //!        option handler.
+   void*                        pHookData;     //!<@brief Optional data of the hooks.
+#ifndef CONFIG_CLOP_FREESTANDING
+   struct OPTION_ARENA_T*       pArena;        //!<@brief Optional arena, mandatory
+                                               //!        for OPT_TYPE_LIST values,
+                                               //!        forwarded to the
+                                               //!        callback functions.
+ #ifndef CONFIG_CLOP_NO_TYPED_VALUES
+   int                          countLists;    //!<@brief Not zero: counting
+                                               //!        pre-pass, the command
+                                               //!        line becomes scanned
+                                               //!        twice, so the array of
+                                               //!        each OPT_TYPE_LIST value
+                                               //!        is allocated exactly once.
+ #endif
+#endif
+};
+
+/*!
+ * @brief The option command line parser by using a parse context.
+ *
+ * Works exactly like parseCommandLineOptionsAt() respectively
+ * parseCommandLineOptionsTableAt() but with the services of the context.
+ *
+ * Example:
+ * @code
+ * struct OPTION_ERROR_T errors[8];
+ * struct OPTION_ERROR_SINK_T errorSink = { .pErrors = errors, .capacity = 8 };
+ * struct OPTION_CONTEXT_T context =
+ * {
+ *    .pTable     = &optTable,
+ *    .pErrorSink = &errorSink,
+ *    .pUser      = &myData
+ * };
+ * char text[256];
+ *
+ * if( parseCommandLineContextAt( 1, argc, ppArgv, &context ) < 0 )
+ * {
+ *    for( size_t i = 0; (i < errorSink.count) && (i < errorSink.capacity); i++ )
+ *    {
+ *       renderOptionError( text, sizeof( text ), ppArgv[0], &errors[i] );
+ *       logMessage( text );
+ *    }
+ * }
+ * @endcode
+ * @param offset Start-offset, initializer of the index for ppArgv[].
+ * @param argc The first argument of your main() function.
+ * @param ppArgv Argument vector the second argument of your main() function.
+ * @param pContext Pointer to the parse context.
+ * @retval <0 Parsing was not successful.
+ * @retval >0 Index-value to the first non-option argument after
+ *            possible options if present.
+ */
+int parseCommandLineContextAt( int offset,
+                               int argc,
+                               char* const ppAgv[],
+                               struct OPTION_CONTEXT_T* pContext
+                             );
+
+#ifndef CONFIG_CLOP_NO_SIMD
+/*!
+ * @brief Matchers of the long options by parsing without compiled table.
+ * @see selectOptionMatcher
+ */
+typedef enum
+{
+   OPT_MATCHER_AUTO   = 0, //!<@brief The best one the processor supports,
+                           //!        default.
+   OPT_MATCHER_SCALAR = 1, //!<@brief Scan of the block-list option by option.
+   OPT_MATCHER_SSE2   = 2, //!<@brief Packed keys, 8 options at a time.
+   OPT_MATCHER_AVX2   = 3  //!<@brief Packed keys, 16 options at a time.
+} OPT_MATCHER_T;
+
+/*!
+ * @brief Selects the process wide matcher of the long options for
+ *        parseCommandLineOptionsAt() and parseCommandLineContextAt()
+ *        without compiled table.
+ *
+ * The vectorized matchers pack the length and 8 characters of each long
+ * option name into a key array on the second long option of each parse
+ * call and compare the key of the argument with 8 respectively 16 keys at
+ * a time, the scan for the '=' of "--OPTION=ARGUMENT" becomes vectorized
+ * as well. The result is exactly the same like the one of
+ * OPT_MATCHER_SCALAR. Short block-lists and processors other than x86
+ * are always parsed by OPT_MATCHER_SCALAR.
+ * @note The long option names must not be changed by the callback functions
+ *       during the parsing.
+ * @param matcher The wanted matcher, a matcher which is not supported by the
+ *                processor becomes replaced by the best supported one.
+ * @return The matcher which becomes used from now on.
+ */
+OPT_MATCHER_T selectOptionMatcher( OPT_MATCHER_T matcher );
+#endif /* ifndef CONFIG_CLOP_NO_SIMD */
+
+#ifndef CONFIG_CLOP_NO_STDIO
+/*!
+ * @brief Ready-made pre-hook of the handler timing report.
+ * @see enableOptionTimingReport
+ */
+void optionTimingPreHook( struct BLOCK_FUNCTION_ARG_T* pArg );
+
+/*!
+ * @brief Ready-made post-hook of the handler timing report.
+ * @see enableOptionTimingReport
+ */
+void optionTimingPostHook( struct BLOCK_FUNCTION_ARG_T* pArg, int ret );
+
+/*!
+ * @brief Prints the report of optionTimingPreHook() and
+ *        optionTimingPostHook(): the option handlers sorted by their
+ *        cumulative time, the slowest one first.
+ * @param pStream Output-file e.g. stdout or stderr.
+ */
+void printOptionTimingReport( FILE* pStream );
+
+/*!
+ * @brief Installs the ready-made timing hooks in the parse context and
+ *        registers the printing of the report in stderr at the exit of
+ *        the process.
+ *
+ * The time of each option handler becomes measured by CLOCK_MONOTONIC.
+ * The hooks are thread safe and can be used by several parse contexts.
+ * Example:
+ * @code
+ * struct OPTION_CONTEXT_T context = { .pOptBlockList = blockList, .pUser = &myData };
+ *
+ * if( getenv( "MYAPP_PROFILE_OPTIONS" ) != NULL )
+ *    enableOptionTimingReport( &context );
+ * parseCommandLineContextAt( 1, argc, ppArgv, &context );
+ * @endcode
+ * Output:
+ * @code
+ * Slowest option handlers:
+ *     total [ms]      calls     max [ms]  option
+ *        412.087          1      412.087  -d PARAM, --dictionary PARAM
+ *          3.120          2        2.901  -o PARAM, --device PARAM
+ * @endcode
+ * @param pContext Pointer to the parse context.
+ */
+void enableOptionTimingReport( struct OPTION_CONTEXT_T* pContext );
+#endif /* ifndef CONFIG_CLOP_NO_STDIO */
+
+struct OPTION_SUBCOMMAND_T;
+
+/*!
+ * @brief Argument-type of the subcommand functions.
+ */
+struct SUBCOMMAND_FUNCTION_ARG_T
+{
+   const int argc;      //!<@brief Forwarding of the argument argc of
+                        //!        parseSubcommandLine().
+   char* const* ppAgv;  //!<@brief Forwarding of the argument ppAgv of
+                        //!        parseSubcommandLine().
+   int argvIndex;       //!<@brief Index of the first non-option argument
+                        //!        after the options of the subcommand,
+                        //!        argc if there is none.
+   struct OPTION_SUBCOMMAND_T* pSubcommand; //!<@brief The invoked subcommand.
+   struct OPTION_CONTEXT_T* pContext; //!<@brief Parse context of the
+                        //!        subcommand, its table respectively
+                        //!        block-list is the one of pSubcommand, so
+                        //!        parseCommandLineContextAt() can continue
+                        //!        with the mixed order.
+   void* pUser;         //!<@brief Forwarding of pContext->pUser.
+};
+
+/*!
+ * @brief Signature of the subcommand functions.
+ * @return Becomes returned by parseSubcommandLine().
+ */
+typedef int (*OPT_SUBCOMMAND_F)( struct SUBCOMMAND_FUNCTION_ARG_T* pArg );
+
+/*!
+ * @brief Node of a subcommand tree like "git remote add", see
+ *        parseSubcommandLine().
+ *
+ * The sub-nodes are a array terminated by OPTION_SUBCOMMAND_END_MARKER.
+ * The compiled option table of a node becomes built not before the node is
+ * reached by a command line, so the costs of the start are proportional to
+ * the taken path and not to the size of the whole tree.
+ */
+struct OPTION_SUBCOMMAND_T
+{
+   const char*                 name;          //!<@brief Name of the subcommand,
+                                              //!        ignored by the root node.
+   struct OPTION_BLOCK_T*      pOptBlockList; //!<@brief Options of the subcommand,
+                                              //!        can be NULL.
+   struct OPTION_SUBCOMMAND_T* pSubcommands;  //!<@brief Optional array of the
+                                              //!        nested subcommands.
+   OPT_SUBCOMMAND_F            function;      //!<@brief Optional function of the
+                                              //!        subcommand.
+   const char*                 helpText;      //!<@brief Help-text for
+                                              //!        writeSubcommandList().
+   const int                   id;            //!<@brief Optional identifier.
+#ifndef CONFIG_CLOP_NO_DLOPEN
+   const char*                 pluginPath;    //!<@brief Optional shared object
+                                              //!        which defines the
+                                              //!        subcommand, loaded by
+                                              //!        dlopen() not before the
+                                              //!        subcommand is invoked.
+   const char*                 pluginSymbol;  //!<@brief Name of the
+                                              //!        OPTION_SUBCOMMAND_T object
+                                              //!        in the shared object.
+#endif
+   struct OPTION_TABLE_T*      pTable;        //!<@brief Private: lazily compiled
+                                              //!        option table, has to be
+                                              //!        NULL initially.
+#ifndef CONFIG_CLOP_NO_DLOPEN
+   void*                       pPluginHandle; //!<@brief Private: handle of the
+                                              //!        loaded shared object.
+   struct OPTION_SUBCOMMAND_T* pPlugin;       //!<@brief Private: subcommand
+                                              //!        object of the plugin.
+#endif
+};
+
+/*!
+ * @brief End-marker of a array of subcommands.
+ */
+#define OPTION_SUBCOMMAND_END_MARKER { .name = NULL }
+
+/*!
+ * @brief Parses a command line of a subcommand tree in the manner of git.
+ *
+ * Beginning by the root node the options of the current node becomes
+ * parsed up to the first non-option argument, which is the name of the
+ * next subcommand when the node has sub-nodes. At the end of the path the
+ * function of the last node becomes invoked with the index of its first
+ * non-option argument. \n
+ * When a node has sub-nodes and a function, so the function becomes invoked
+ * by a missing or unknown subcommand name, otherwise it's a error.
+ *
+ * Example:
+ * @code
+ * struct OPTION_SUBCOMMAND_T remoteCommands[] =
+ * {
+ *    { .name = "add",    .pOptBlockList = remoteAddOpts, .function = remoteAdd },
+ *    { .name = "remove", .function = remoteRemove },
+ *    OPTION_SUBCOMMAND_END_MARKER
+ * };
+ * struct OPTION_SUBCOMMAND_T commands[] =
+ * {
+ *    { .name = "commit", .pOptBlockList = commitOpts, .function = commit },
+ *    { .name = "remote", .pSubcommands = remoteCommands },
+ *    OPTION_SUBCOMMAND_END_MARKER
+ * };
+ * struct OPTION_SUBCOMMAND_T root =
+ * {
+ *    .pOptBlockList = globalOpts,
+ *    .pSubcommands  = commands
+ * };
+ * struct OPTION_CONTEXT_T context = { .pUser = &myData };
+ *
+ * int ret = parseSubcommandLine( argc, ppArgv, &root, &context );
+ * freeSubcommandTables( &root );
+ * @endcode
+ *
+ * The option table of a node becomes compiled and validated by
+ * initOptionTableWithSink() on its first use, the findings go to the error
+ * sink of the parse context. The table becomes shared by all
+ * later and concurrent invocations. Without memory respectively by
+ * CONFIG_CLOP_FREESTANDING the block-list becomes parsed directly. \n
+ * The names of the subcommands becomes compared linearly, that is cheap
+ * for the usual number of sub-nodes.
+ *
+ * A subcommand with pluginPath is a placeholder for the OPTION_SUBCOMMAND_T
+ * object pluginSymbol in a shared object: By its first invocation the
+ * shared object becomes loaded by dlopen() and the parsing continues by
+ * the options, sub-nodes and function of the plugin object, only its name
+ * is ignored. So the relocations and the memory of plugins are paid only
+ * by the plugin which is really used. A plugin which can't be loaded
+ * becomes reported by OPT_ERR_PLUGIN_NOT_LOADABLE respectively
+ * OPT_ERR_PLUGIN_SYMBOL_NOT_FOUND. Define CONFIG_CLOP_NO_DLOPEN if you
+ * don't need it.
+ * @code
+ * // Plugin, linked as shared object libremote.so:
+ * struct OPTION_SUBCOMMAND_T remotePlugin =
+ * {
+ *    .pOptBlockList = remoteOpts,
+ *    .pSubcommands  = remoteCommands
+ * };
+ *
+ * // Main program:
+ * { .name = "remote", .pluginPath = "libremote.so", .pluginSymbol = "remotePlugin" },
+ * @endcode
+ * @param argc The first argument of your main() function.
+ * @param ppAgv Argument vector the second argument of your main() function.
+ * @param pRoot Root node, its options are the global ones.
+ * @param pContext Optional parse context for the services of the parser,
+ *        its members pOptBlockList and pTable becomes ignored.
+ * @retval <0 Parsing was not successful.
+ * @return Return value of the function of the invoked subcommand
+ *         respectively the index of the first non-option argument after
+ *         the path when the last node has no function.
+ */
+int parseSubcommandLine( int argc,
+                         char* const ppAgv[],
+                         struct OPTION_SUBCOMMAND_T* pRoot,
+                         struct OPTION_CONTEXT_T* pContext
+                       );
+
+#ifndef CONFIG_CLOP_FREESTANDING
+/*!
+ * @brief Releases the option tables of the whole subcommand tree which
+ *        has been compiled by parseSubcommandLine() and unloads the
+ *        plugins.
+ * @note Not during a parseSubcommandLine() of a other thread.
+ * @param pRoot Root node.
+ */
+void freeSubcommandTables( struct OPTION_SUBCOMMAND_T* pRoot );
+#endif
+
+/*!
+ * @brief Writes the names and help-texts of a array of subcommands in the
+ *        format of writeOptionList() by your write function.
+ * @param write Your write function.
+ * @param pHandle Handle for your write function.
+ * @param subcommands Array of subcommands, e.g. pRoot->pSubcommands.
+ */
+void writeSubcommandList( OPT_WRITE_F write, void* pHandle,
+                          const struct OPTION_SUBCOMMAND_T subcommands[] );
+
+/*!
+ * @brief Renders the message text of a error record like the parser writes
+ *        it in stderr when no error sink is given, ending by '\n'.
+ *
+ * Semantic of the return value like snprintf(): The text becomes truncated
+ * and terminated when size is to small.
+ * @param pBuffer Target buffer, can be NULL when size is 0.
+ * @param size Size of the target buffer.
+ * @param prgName Program name for the begin of the message, e.g. ppArgv[0].
+ * @param pError Pointer to the error record.
+ * @return Length of the whole text without the terminating zero.
+ */
+size_t renderOptionError( char* pBuffer, size_t size, const char* prgName,
+                          const struct OPTION_ERROR_T* pError );
+
+/*!
+ * @brief Return values of parseNextOption().
+ */
+typedef enum
+{
+   OPT_ITER_FATAL   = -2, //!<@brief Missing option or missing argument,
+                          //!        a message has been written in stderr. \n
+                          //!        The iteration can not be continued.
+   OPT_ITER_UNKNOWN = -1, //!<@brief Unrecognized or ambiguous option, a message
+                          //!        has been written in stderr. \n
+                          //!        The iteration can be continued.
+   OPT_ITER_END     =  0, //!<@brief No further option. OPTION_ITERATOR_T::argvIndex
+                          //!        is the index of the first non-option argument
+                          //!        or argc.
+   OPT_ITER_FOUND   =  1  //!<@brief Option found.
+} OPT_ITER_RESULT_T;
+
+/*!
+ * @brief State of the option iterator for parseNextOption().
+ *
+ * The whole state of the iteration lives in this object which is owned by
+ * you, so the parsing can be interleaved with other work and stopped at any
+ * time.
+ * @see initOptionIterator
+ * @see parseNextOption
+ */
+struct OPTION_ITERATOR_T
+{
+   const struct OPTION_BLOCK_T* pBlock; //!<@brief The found option block.
+   const char*  optArg;     //!<@brief Pointer to a possible option-argument,
+                            //!        otherwise NULL.
+   int          argvIndex;  //!<@brief Current index value of the argument vector.
+   /* Private members: */
+   int          argc;                          //!<@brief Private.
+   char* const* ppAgv;                         //!<@brief Private.
+   struct OPTION_BLOCK_T* pOptBlockList;       //!<@brief Private.
+   const struct OPTION_TABLE_T* pTable;        //!<@brief Private.
+   int          limit;                         //!<@brief Private.
+   int          nextIndex;                     //!<@brief Private.
+   char*        pCurrent;                      //!<@brief Private.
+   struct OPTION_ERROR_SINK_T* pErrorSink;     //!<@brief Optional error sink,
+                                               //!        NULL after the
+                                               //!        initialization.
+   struct OPTION_KEYS_T* pKeys;                //!<@brief Private, packed keys
+                                               //!        of the long options.
+};
+
+/*!
+ * @brief Initializes a option iterator.
+ * @param pIt Pointer to the iterator object to initialize.
+ * @param offset Start-offset, initializer of the index for ppArgv[].
+ * @param argc The first argument of your main() function.
+ * @param ppArgv Argument vector the second argument of your main() function.
+ * @param optBlockList Pointer to your defined option-block-list.
+ */
+void initOptionIterator( struct OPTION_ITERATOR_T* pIt,
+                         int offset,
+                         int argc,
+                         char* const ppAgv[],
+                         struct OPTION_BLOCK_T optBlockList[] );
+
+/*!
+ * @brief Initializes a option iterator by using a compiled option table.
+ * @see initOptionIterator
+ * @see initOptionTable
+ */
+void initOptionIteratorTable( struct OPTION_ITERATOR_T* pIt,
+                              int offset,
+                              int argc,
+                              char* const ppAgv[],
+                              const struct OPTION_TABLE_T* pTable );
+
+/*!
+ * @brief Pull-style alternative of parseCommandLineOptionsAt(): delivers the
+ *        next option of the command line without invoking the callback function.
+ *
+ * Each invocation delivers one option, also each single option of a cluster
+ * like "-abc". The parser functions parseCommandLineOptionsAt() and
+ * parseCommandLineOptionsTableAt() are implemented on top of this function,
+ * so the behavior is the same.
+ *
+ * Example:
+ * @code
+ * struct OPTION_ITERATOR_T it;
+ * OPT_ITER_RESULT_T ret;
+ *
+ * initOptionIterator( &it, 1, argc, ppArgv, blockList );
+ * while( (ret = parseNextOption( &it )) != OPT_ITER_END )
+ * {
+ *    if( ret == OPT_ITER_FATAL )
+ *       return EXIT_FAILURE;
+ *    if( ret == OPT_ITER_UNKNOWN )
+ *       continue;
+ *    printf( "Option %d at ppArgv[%d] argument: %s\n", it.pBlock->id,
+ *            it.argvIndex, (it.optArg != NULL)? it.optArg : "none" );
+ *    // Do something other...
+ * }
+ * // it.argvIndex is the index of the first non-option argument.
+ * @endcode
+ * @param pIt Pointer to the initialized iterator object.
+ * @return Result of type OPT_ITER_RESULT_T.
+ */
+OPT_ITER_RESULT_T parseNextOption( struct OPTION_ITERATOR_T* pIt );
+
+#ifndef CONFIG_CLOP_NO_STREAM
+/*!
+ * @brief Signature of the reader functions of a argument stream.
+ * @param pSource Forwarding of OPTION_STREAM_T::pSource.
+ * @param pBuffer Target buffer.
+ * @param size Maximum number of bytes to read.
+ * @retval >0  Number of bytes read.
+ * @retval ==0 End of stream.
+ * @retval <0  Error.
+ */
+typedef long (*OPT_READ_F)( void* pSource, char* pBuffer, size_t size );
+
+/*!
+ * @brief Argument stream for parseOptionStream().
+ *
+ * The arguments becomes read in chunks into a fixed buffer, so the
+ * memory consumption doesn't depend on the length of the stream. \n
+ * The buffer has to be large enough for at least four arguments, because
+ * a option can consume up to three arguments, e.g. "-O = ARGUMENT".
+ * @see initOptionStream
+ */
+struct OPTION_STREAM_T
+{
+   OPT_READ_F  read;       //!<@brief Reader function.
+   void*       pSource;    //!<@brief Argument of the reader function,
+                           //!        e.g. pointer to a file descriptor.
+   char*       pBuffer;    //!<@brief Buffer for the arguments.
+   size_t      bufferSize; //!<@brief Size of the buffer.
+   char        delimiter;  //!<@brief Delimiter of the arguments. \n
+                           //! ' ' (default): runs of white spaces, \n
+                           //! '\0': zero terminated arguments like xargs -0, \n
+                           //! each other: exact this character e.g. '\n'.
+   OPT_BLOCK_F nonOptionFunction; //!<@brief Optional callback function for
+                           //! the non-option arguments. It becomes
+                           //! invoked with OPTION_BLOCK_T::pCurrentBlock == NULL
+                           //! and the argument in BLOCK_FUNCTION_ARG_T::optArg. \n
+                           //! If NULL, so a non-option argument is a error.
+   /* Private members: */
+   size_t      begin;      //!<@brief Private.
+   size_t      tokenStart; //!<@brief Private.
+   size_t      scan;       //!<@brief Private.
+   size_t      end;        //!<@brief Private.
+   int         eof;        //!<@brief Private.
+};
+
+/*!
+ * @brief Initializes a argument stream object.
+ *
+ * After the initialization you can change the members delimiter and
+ * nonOptionFunction.
+ * @param pStream Pointer to the stream object to initialize.
+ * @param read Reader function, e.g. readOptionStreamFd().
+ * @param pSource Argument of the reader function.
+ * @param pBuffer Buffer for the arguments.
+ * @param bufferSize Size of the buffer, it determines the maximum length
+ *                   of the arguments.
+ */
+void initOptionStream( struct OPTION_STREAM_T* pStream,
+                       OPT_READ_F read, void* pSource,
+                       char* pBuffer, size_t bufferSize );
+
+/*!
+ * @brief Reader function for file descriptors, e.g. stdin or pipes.
+ * @param pSource Pointer to the file descriptor of type int.
+ * @see OPT_READ_F
+ */
+long readOptionStreamFd( void* pSource, char* pBuffer, size_t size );
+
+/*!
+ * @brief The option parser for argument streams.
+ *
+ * Works like parseCommandLineOptionsAt() but the arguments comes from a
+ * stream instead of the argument vector, so the stream can be larger than
+ * the memory. The callback functions becomes invoked as soon as the
+ * arguments has been arrived.
+ *
+ * Example for arguments from stdin:
+ * @code
+ * char buffer[4096];
+ * int fd = STDIN_FILENO;
+ * struct OPTION_STREAM_T stream;
+ *
+ * initOptionStream( &stream, readOptionStreamFd, &fd, buffer, sizeof( buffer ) );
+ * stream.nonOptionFunction = myNonOptionCallback;
+ *
+ * if( parseOptionStream( &stream, ppArgv[0], blockList, &myData ) < 0 )
+ *    return EXIT_FAILURE;
+ * @endcode
+ *
+ * @note In the callback functions BLOCK_FUNCTION_ARG_T::ppAgv and
+ *       BLOCK_FUNCTION_ARG_T::argc describes a small sliding window of the
+ *       stream only: ppAgv[0] is the program name, ppAgv[argvIndex] the
+ *       current argument. The arguments are valid within the callback
+ *       function only, copy them if you need them later. For the same
+ *       reason OPT_TYPE_STRING and OPT_TYPE_LIST options are not possible,
+ *       such a block-list becomes rejected by OPT_ERR_INVALID_OPTION_BLOCK.
+ * @param pStream Pointer to the initialized stream object.
+ * @param prgName Program name for error messages, e.g. ppArgv[0].
+ * @param optBlockList Pointer to your defined option-block-list.
+ * @param pUser Optional pointer to your data structure.
+ * @retval ==0 Parsing of the whole stream was successful.
+ * @retval <0  Parsing was not successful.
+ */
+int parseOptionStream( struct OPTION_STREAM_T* pStream,
+                       const char* prgName,
+                       struct OPTION_BLOCK_T optBlockList[],
+                       void* pUser );
+
+/*!
+ * @brief The option parser for argument streams by using a compiled
+ *        option table.
+ * @see parseOptionStream
+ * @see initOptionTable
+ */
+int parseOptionStreamTable( struct OPTION_STREAM_T* pStream,
+                            const char* prgName,
+                            const struct OPTION_TABLE_T* pTable,
+                            void* pUser );
+
+/*!
+ * @brief The option parser for argument streams by using a parse context.
+ *
+ * Like parseOptionStream() respectively parseOptionStreamTable(), but with
+ * the services of the parse context: the errors, also those of the stream
+ * itself, becomes reported in its error sink, the hooks becomes invoked
+ * and its arena is available for the callback functions. The argvIndex of
+ * the error records is the index in the sliding window. \n
+ * OPT_TYPE_STRING and OPT_TYPE_LIST options are not possible, because
+ * they store pointers to the arguments and the arguments of the stream are
+ * not stable, such a block-list becomes rejected by
+ * OPT_ERR_INVALID_OPTION_BLOCK.
+ * @param pStream Pointer to the initialized stream object.
+ * @param prgName Program name for error messages, e.g. ppArgv[0].
+ * @param pContext Pointer to the parse context, OPTION_CONTEXT_T::countLists
+ *                 becomes ignored.
+ * @retval ==0 Parsing of the whole stream was successful.
+ * @retval <0  Parsing was not successful.
+ * @see parseCommandLineContextAt
+ */
+int parseOptionStreamContext( struct OPTION_STREAM_T* pStream,
+                              const char* prgName,
+                              struct OPTION_CONTEXT_T* pContext );
+#endif /* ifndef CONFIG_CLOP_NO_STREAM */
+
+#ifndef CONFIG_CLOP_NO_RESPONSE_FILES
+/*!
+ * @brief Mapping of a response file.
+ * @note This is a internal data type of RESPONSE_FILE_ARGS_T.
+ */
+struct RESPONSE_FILE_MAP_T
+{
+   void*  pAddress;
+   size_t size;
+};
+
+/*!
+ * @brief Argument vector expanded by expandResponseFiles().
+ */
+struct RESPONSE_FILE_ARGS_T
+{
+   int    argc;    //!<@brief Number of arguments of the expanded vector.
+   char** ppArgv;  //!<@brief Expanded argument vector, terminated by NULL.
+   struct RESPONSE_FILE_MAP_T* pMaps; //!<@brief Private: mapped response files.
+   size_t numOfMaps;                  //!<@brief Private: number of mappings.
+   struct OPTION_ERROR_SINK_T* pErrorSink; //!<@brief Private: error sink of
+                                      //!        expandResponseFilesWithSink().
+   char* const* ppOrigin;             //!<@brief Private: origin vector.
+   int    argvIndex;                  //!<@brief Private: index of the expanded
+                                      //!        argument in the origin vector.
+};
+
+/*!
+ * @brief Expands the response files in the argument vector.
+ *
+ * Each argument in the shape "@file" becomes replaced by the arguments
+ * which are written in the file "file", separated by white spaces. Like in
+ * GCC, single or double quotes and backslash escapes are possible within
+ * the file, and response files can contain further "@file" arguments. \n
+ * If the file can't be opened, so the argument "@file" remains unchanged.
+ *
+ * The response files becomes mapped into the memory and tokenized in place,
+ * so the arguments of the expanded vector and also the optArg pointers in
+ * your callback functions points directly into the mapping. Only the
+ * vector itself becomes allocated.
+ *
+ * Example:
+ * @code
+ * struct RESPONSE_FILE_ARGS_T args;
+ *
+ * if( expandResponseFiles( &args, argc, ppArgv ) != 0 )
+ *    return EXIT_FAILURE;
+ *
+ * int i = parseCommandLineOptions( args.argc, args.ppArgv, blockList, &myData );
+ *
+ * // Use the arguments...
+ *
+ * releaseResponseFiles( &args );
+ * @endcode
+ *
+ * @note The arguments are valid until releaseResponseFiles() becomes invoked.
+ * @param pArgs Pointer to the object which receives the expanded vector.
+ * @param argc The first argument of your main() function.
+ * @param ppArgv Argument vector the second argument of your main() function.
+ *               The first element (program name) will not expanded.
+ * @retval ==0 Success.
+ * @retval <0  Error, a message has been written in stderr.
+ */
+int expandResponseFiles( struct RESPONSE_FILE_ARGS_T* pArgs,
+                         int argc, char* const ppArgv[] );
+
+/*!
+ * @brief Like expandResponseFiles(), but the errors becomes reported in
+ *        the error sink.
+ *
+ * OPTION_ERROR_T::argvIndex is the index of the concerned argument
+ * "@file" in ppArgv[] and pToken points to it, the error can concern a
+ * response file nested in it as well.
+ * @param pArgs Pointer to the object which receives the expanded vector.
+ * @param argc The first argument of your main() function.
+ * @param ppArgv Argument vector the second argument of your main() function.
+ * @param pSink Optional error sink, if NULL the errors becomes reported
+ *              in stderr.
+ * @retval ==0 Success.
+ * @retval <0  Error.
+ */
+int expandResponseFilesWithSink( struct RESPONSE_FILE_ARGS_T* pArgs,
+                                 int argc, char* const ppArgv[],
+                                 struct OPTION_ERROR_SINK_T* pSink );
+
+/*!
+ * @brief Releases the expanded argument vector and the mappings of the
+ *        response files made by expandResponseFiles().
+ * @param pArgs Pointer to the object of expandResponseFiles().
+ */
+void releaseResponseFiles( struct RESPONSE_FILE_ARGS_T* pArgs );
+#endif /* ifndef CONFIG_CLOP_NO_RESPONSE_FILES */
+
+#ifndef CONFIG_CLOP_NO_THREADS
+/*!
+ * @brief Item of a command line for parseCommandLineBatch().
+ */
+struct OPTION_BATCH_ITEM_T
+{
+   int          argc;    //!<@brief Number of arguments including ppArgv[0].
+   char* const* ppArgv;  //!<@brief Argument vector, ppArgv[0] is the program-
+                         //!        respectively request name.
+   void*        pUser;   //!<@brief User tunnel for the callback functions of
+                         //!        this item.
+   struct OPTION_ERROR_SINK_T* pErrorSink; //!<@brief Optional error sink of
+                         //!        this item, if NULL the errors becomes
+                         //!        written in stderr by several threads
+                         //!        at once.
+   int          result;  //!<@brief Return value of
+                         //!        parseCommandLineOptionsTableAt() for this item.
+};
+
+/*!
+ * @brief Parses a batch of command lines against the same compiled option
+ *        table by a pool of worker threads.
+ *
+ * Each item becomes parsed beginning at the offset 1 like
+ * parseCommandLineOptionsTable() and the return value becomes stored in
+ * OPTION_BATCH_ITEM_T::result. \n
+ * The items becomes distributed dynamically in small portions over the
+ * workers, the calling thread works as well. The table and the parser are
+ * strictly read-only, so the callback functions are the only shared state:
+ * They has to be thread safe, that means they shall modify only the
+ * object given by pArg->pUser of its item. Give each item its own error
+ * sink to get the errors per command line. \n
+ * If the threads can't be created, e.g. by lack of memory, the calling
+ * thread parses the remaining items alone.
+ * @note Define CONFIG_CLOP_NO_THREADS if you don't need it.
+ * @param items Array of the command lines to parse.
+ * @param numOfItems Number of elements in items[].
+ * @param pTable Pointer to the initialized option table.
+ * @param numOfThreads Maximum number of threads including the calling thread.
+ *        When 0 then the number of online processors becomes used.
+ * @retval 0  All items has been parsed, the results are in items[].
+ */
+int parseCommandLineBatch( struct OPTION_BATCH_ITEM_T items[],
+                           size_t numOfItems,
+                           const struct OPTION_TABLE_T* pTable,
+                           unsigned int numOfThreads );
+#endif /* ifndef CONFIG_CLOP_NO_THREADS */
+
+#ifndef CONFIG_CLOP_NO_STDIO
+/*!
+ * @brief Prints the schort option (if present) and long option
+ *        (if present) of a option-block in the file pStream.
+ *
+ * Helper-function can be used to simplify e.g. your print-help-function
+ * and/or error messages in your callback-functions. \n
+ * Example:
+ * @code
+ * static int optOneOfMyCallbackFunctions( struct BLOCK_FUNCTION_ARG_T* pArg )
+ * {
+ *   //... do something ...
+ *   if( something_was_wrong )
+ *   {
+ *      fprintf( stderr, "Error in option: \"" );
+ *      printOption( stderr, pArg->pCurrentBlock );
+ *      fprintf( stderr "\" bla bla bla :-(\n" );
+ *      return -1;
+ *   }
+ *   return 0;
+ * }
+ * @endcode
+ * @param pStream Output-file e.g. stdout or stderr.
+ * @param pOptionBlock Pointer to the option-block.
+ */
+void printOption( FILE* pStream, const struct OPTION_BLOCK_T* pOptionBlock );
+
+/*!
+ * @brief Prints the formatted content of each element of your option-block-list
+ *        in the file pStream.
+ *
+ * Helper-function can be used to simplify your print-help-function. \n
+ * The whole text becomes rendered at first and then written by a single
+ * fwrite() invocation. \n
+ * Example:
+ * @code
+ * static int optPrintMyHelp( struct BLOCK_FUNCTION_ARG_T* pArg )
+ * {
+ *    printf( "Bla bla bla ...\n" );
+ *    printf( "Usage: %s [options] bla bla bla...\n". pArg->ppAgv[0] );
+ *    printf( "Options:\n" );
+ *    printOptionList( stdout, pArg->pOptBlockList );
+ *    exit( EXIT_SUCCESS );
+ *    return 0;
+ * }
+ * @endcode
+ * @param pStream Output-file e.g. stdout or stderr.
+ * @param optBlockList Start-pointer to your option-block-list.
+ */
+void printOptionList( FILE* pStream, struct OPTION_BLOCK_T optBlockList[] );
+#endif /* ifndef CONFIG_CLOP_NO_STDIO */
+
+/*!
+ * @brief Renders the short option (if present) and long option (if present)
+ *        of a option-block in the same format like printOption() in a buffer.
+ *
+ * Works like snprintf(): the buffer becomes always zero terminated if size > 0
+ * and the return value is the length of the whole text, so a
+ * return value >= size means the text has been truncated.
+ * @param pBuffer Target buffer, can be NULL if size is 0.
+ * @param size Size of the buffer.
+ * @param pOptionBlock Pointer to the option-block.
+ * @return Length of the text without the terminating zero.
+ */
+size_t renderOption( char* pBuffer, size_t size,
+                     const struct OPTION_BLOCK_T* pOptionBlock );
+
+/*!
+ * @brief Renders the formatted content of each element of your
+ *        option-block-list in the same format like printOptionList() in
+ *        a buffer, e.g. for embedded systems without file streams.
+ *
+ * Works like snprintf(), so you can obtain the required size by a first
+ * invocation with size == 0:
+ * @code
+ * size_t size = renderOptionList( NULL, 0, blockList ) + 1;
+ * @endcode
+ * @param pBuffer Target buffer, can be NULL if size is 0.
+ * @param size Size of the buffer.
+ * @param optBlockList Start-pointer to your option-block-list.
+ * @return Length of the text without the terminating zero.
+ */
+size_t renderOptionList( char* pBuffer, size_t size,
+                         struct OPTION_BLOCK_T optBlockList[] );
+
+/*!
+ * @brief Writes the short option (if present) and long option (if present)
+ *        of a option-block in the same format like printOption() by your
+ *        write function.
+ *
+ * The text becomes rendered piecewise in a small buffer on the stack,
+ * so no memory becomes allocated.
+ * @param write Your write function, e.g. for the UART of a embedded target.
+ * @param pHandle Handle for your write function.
+ * @param pOptionBlock Pointer to the option-block.
+ */
+void writeOption( OPT_WRITE_F write, void* pHandle,
+                  const struct OPTION_BLOCK_T* pOptionBlock );
+
+/*!
+ * @brief Writes the formatted content of each element of your
+ *        option-block-list in the same format like printOptionList() by your
+ *        write function.
+ *
+ * Like writeOption() without allocation of memory, so the usable
+ * counterpart of printOptionList() for CONFIG_CLOP_FREESTANDING.
+ * @param write Your write function, e.g. for the UART of a embedded target.
+ * @param pHandle Handle for your write function.
+ * @param optBlockList Start-pointer to your option-block-list.
+ */
+void writeOptionList( OPT_WRITE_F write, void* pHandle,
+                      struct OPTION_BLOCK_T optBlockList[] );
+
+/*!
+ * @brief First argument of a shell completion request:
+ *        "program __complete [words before the cursor] [word to complete]".
+ */
+#define OPTION_COMPLETE_COMMAND  "__complete"
+
+/*!
+ * @brief First line of the answer of completeCommandLine(): the word to
+ *        complete is a option, the candidates are following.
+ */
+#define OPTION_COMPLETE_OPTION   ":option"
+
+/*!
+ * @brief First line of the answer of completeCommandLine(): the word to
+ *        complete is a option-argument. The candidates are following when
+ *        they are known (OPT_TYPE_ENUM), otherwise the shell completes
+ *        file names.
+ */
+#define OPTION_COMPLETE_ARGUMENT ":argument"
+
+/*!
+ * @brief First line of the answer of completeCommandLine(): the word to
+ *        complete is a non-option argument, the shell completes file names.
+ */
+#define OPTION_COMPLETE_OPERAND  ":operand"
+
+/*!
+ * @brief Answers a shell completion request, so the completion scripts of
+ *        the directory "completion" doesn't need to grep the help text.
+ *
+ * Call it before the parsing, if ppAgv[1] is OPTION_COMPLETE_COMMAND
+ * the words after it are the command line up to the cursor, the last one
+ * is the word to complete. The words before it becomes parsed by the
+ * iterator without invoking any callback function, to find out whether
+ * the word is the argument of a REQUIRED_ARG option. The answer is a line
+ * with OPTION_COMPLETE_OPTION, OPTION_COMPLETE_ARGUMENT or
+ * OPTION_COMPLETE_OPERAND followed by one line per candidate:
+ * the candidate, a tabulator and the first line of its help text. \n
+ * Long option candidates are taken from the sorted name index of
+ * enableOptionPrefixMatching() in O(log n), otherwise by a linear search.
+ *
+ * Example:
+ * @code
+ * struct OPTION_CONTEXT_T context = { .pTable = &optTable, .pUser = &myData };
+ *
+ * if( completeCommandLine( argc, ppArgv, &context, NULL, NULL ) )
+ *    return EXIT_SUCCESS;
+ * parseCommandLineContextAt( 1, argc, ppArgv, &context );
+ * @endcode
+ * @code
+ * $ mytool __complete --log --verb
+ * :option
+ * --verbose	Be verbose
+ * --verbosity	Level of the messages
+ * @endcode
+ * @param argc The first argument of your main() function.
+ * @param ppAgv Argument vector the second argument of your main() function.
+ * @param pContext Parse context, only pTable respectively pOptBlockList
+ *        becomes used.
+ * @param write Write function of the answer, when NULL stdout.
+ *        Mandatory by CONFIG_CLOP_NO_STDIO.
+ * @param pHandle Handle for the write function.
+ * @retval 0 It isn't a completion request, nothing has been done.
+ * @retval 1 The answer has been written, the program can exit.
+ */
+int completeCommandLine( int argc,
+                         char* const ppAgv[],
+                         struct OPTION_CONTEXT_T* pContext,
+                         OPT_WRITE_F write,
+                         void* pHandle
+                       );
+
+#ifndef CONFIG_CLOP_FREESTANDING
+/*!
+ * @brief Returns the text of printOptionList() in a allocated buffer,
+ *        so you can cache it.
+ * @note Release the text by free().
+ * @param optBlockList Start-pointer to your option-block-list.
+ * @return Zero terminated text or NULL if not enough memory.
+ */
+char* createOptionListText( struct OPTION_BLOCK_T optBlockList[] );
+#endif
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,675 @@
+/*****************************************************************************/
+/*                                                                           */
+/*!  @brief Compile-time option tables for C++17 of the option parser       */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*! @file    parse_opts.hpp                                                  */
+/*! @see     parse_opts.h                                                    */
+/*  Library: libParseOptsC.so, resp: -lParseOptsC                            */
+/*! @author  Ulrich Becker                                                   */
+/*! @date    16.10.2026                                                      */
+/*  Updates:                                                                 */
+/*! @example cmd_opt_ex4.cpp Example for a compile-time option table.       */
+/*****************************************************************************/
+/*
+ * MIT License
+ *
+ * Copyright (c) 2016 Ulrich Becker
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef _PARSE_OPTS_HPP
+#define _PARSE_OPTS_HPP
+
+#if !defined( __cplusplus ) || (__cplusplus < 201703L)
+   #error "parse_opts.hpp needs at least C++17!"
+#endif
+
+#include <parse_opts.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/*!
+ * @brief Header-only C++ front end of the option parser.
+ *
+ * The option table becomes a constexpr object, the hash index, the
+ * packed arrays of the lookup fields, the dispatch table of the short
+ * options and the optional prefix index becomes computed by the compiler,
+ * so no initOptionTable() is necessary at runtime. Duplicate option names
+ * becomes rejected by static_assert.
+ *
+ * The option functions are real C++ lambdas, COMPILED_T::parse() invokes
+ * them by a dispatch generated per table, so they can be inlined and the
+ * parse loop contains no indirect call.
+ *
+ * Example:
+ * @code
+ * struct MY_DATA { bool verbose; const char* pName; };
+ *
+ * static constexpr auto g_options = clop::makeTable(
+ *    clop::makeOption( 'v', "verbose", NO_ARG, "Be verbose.",
+ *       []( BLOCK_FUNCTION_ARG_T& arg )
+ *       {
+ *          static_cast<MY_DATA*>( arg.pUser )->verbose = true;
+ *       }),
+ *    clop::makeOption( 'n', "name", REQUIRED_ARG, "Name of something.",
+ *       []( BLOCK_FUNCTION_ARG_T& arg )
+ *       {
+ *          static_cast<MY_DATA*>( arg.pUser )->pName = arg.optArg;
+ *       })
+ * );
+ *
+ * int main( int argc, char** ppArgv )
+ * {
+ *    MY_DATA myData = { false, nullptr };
+ *    for( int i = 1; i < argc; i++ )
+ *    {
+ *       i = clop::COMPILED_T<g_options>::parse( i, argc, ppArgv, &myData );
+ *       if( i < 0 )
+ *          return EXIT_FAILURE;
+ *       if( i < argc )
+ *          printf( "Non option argument: \"%s\"\n", ppArgv[i] );
+ *    }
+ *    return EXIT_SUCCESS;
+ * }
+ * @endcode
+ */
+namespace clop
+{
+
+/*!
+ * @brief Definition of a single option of a compile-time table.
+ * @see makeOption
+ */
+template <typename F>
+struct OPTION_T
+{
+   char          shortOpt; //!<@brief Short option or 0 when not used.
+   const char*   longOpt;  //!<@brief Long option or nullptr when not used.
+   ARG_REQUIRE_T hasArg;   //!<@brief NO_ARG, REQUIRED_ARG or OPTIONAL_ARG.
+   const char*   helpText; //!<@brief Help text for printOptionList().
+   F             function; //!<@brief Lambda invoked when the option was found.
+                           //! Accepted signatures are
+                           //! (BLOCK_FUNCTION_ARG_T&), (const char* optArg)
+                           //! and (), the return type is int or void. \n
+                           //! A return value < 0 terminates the parser,
+                           //! > 0 marks the command line as erroneous,
+                           //! void becomes 0.
+};
+
+/*!
+ * @brief Creates a option for makeTable().
+ * @note The lambda has to be captureless, otherwise the table can not be
+ *       a constexpr object.
+ */
+template <typename F>
+constexpr OPTION_T<F> makeOption( char shortOpt, const char* longOpt,
+                                  ARG_REQUIRE_T hasArg, const char* helpText,
+                                  F function )
+{
+   return { shortOpt, longOpt, hasArg, helpText, function };
+}
+
+/*!
+ * @brief Compile-time option table.
+ * @see makeTable
+ * @see COMPILED_T
+ */
+template <typename... F>
+struct TABLE_T
+{
+   std::tuple<OPTION_T<F>...> options;  //!<@brief The options in the order
+                                        //! of printOptionList().
+   bool uniquePrefixes;                 //!<@brief When true, a unique
+                                        //! prefix of a long option becomes
+                                        //! accepted.
+                                        //! @see enableOptionPrefixMatching
+
+   static constexpr std::size_t size = sizeof...( F ); //!<@brief Number of options.
+
+   /*!
+    * @brief Returns a copy of this table which accepts unique prefixes
+    *        of the long options, e.g. "--verb" for "--verbose".
+    *
+    * The counterpart of enableOptionPrefixMatching(), but the sorted
+    * prefix index becomes built at compile time.
+    */
+   constexpr TABLE_T withUniquePrefixes( void ) const
+   {
+      return { options, true };
+   }
+};
+
+/*!
+ * @brief Creates a compile-time option table.
+ * @note The result has to become stored in a variable with static storage
+ *       duration (e.g. "static constexpr auto") because COMPILED_T takes it
+ *       by reference as template argument.
+ */
+template <typename... F>
+constexpr TABLE_T<F...> makeTable( const OPTION_T<F>&... options )
+{
+   return { { options... }, false };
+}
+
+namespace detail
+{
+
+/*!
+ * @brief The function-free part of a option, uniform for all lambda types.
+ */
+struct INFO_T
+{
+   char          shortOpt;
+   const char*   longOpt;
+   ARG_REQUIRE_T hasArg;
+   const char*   helpText;
+};
+
+constexpr INFO_T NO_INFO = { 0, nullptr, NO_ARG, nullptr };
+
+/*-----------------------------------------------------------------------------
+*/
+template <typename TABLE, std::size_t... I>
+constexpr std::array<INFO_T, sizeof...( I ) + 1>
+makeInfo( const TABLE& rTable, std::index_sequence<I...> )
+{
+   /* + 1 keeps the array not empty for a table without options. */
+   return {{ { std::get<I>( rTable.options ).shortOpt,
+               std::get<I>( rTable.options ).longOpt,
+               std::get<I>( rTable.options ).hasArg,
+               std::get<I>( rTable.options ).helpText }..., NO_INFO }};
+}
+
+/*-----------------------------------------------------------------------------
+ * All members explicit, so -Wextra stays quiet.
+*/
+constexpr OPTION_BLOCK_T makeBlock( OPT_BLOCK_F function, const INFO_T& rInfo, int id )
+{
+   return { function, rInfo.hasArg, id, rInfo.shortOpt, rInfo.longOpt, rInfo.helpText
+         #ifndef CONFIG_CLOP_NO_TYPED_VALUES
+            , OPT_VALUE_TYPE_T(), 0, nullptr
+         #endif
+          };
+}
+
+/*-----------------------------------------------------------------------------
+*/
+constexpr std::size_t length( const char* pName )
+{
+   std::size_t len = 0;
+   while( pName[len] != '\0' )
+      len++;
+   return len;
+}
+
+/*-----------------------------------------------------------------------------
+ * Counterpart of strcmp().
+*/
+constexpr int compare( const char* p1, const char* p2 )
+{
+   while( (*p1 != '\0') && (*p1 == *p2) )
+   {
+      p1++;
+      p2++;
+   }
+   return static_cast<int>( static_cast<unsigned char>( *p1 ) ) -
+          static_cast<int>( static_cast<unsigned char>( *p2 ) );
+}
+
+/*-----------------------------------------------------------------------------
+ * Counterpart of optionNameHash().
+*/
+constexpr std::uint32_t hash( const char* pName )
+{
+   std::uint32_t h = OPTION_HASH_INIT;
+   while( *pName != '\0' )
+   {
+      h = OPTION_HASH_STEP( h, *pName );
+      pName++;
+   }
+   return h;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+template <std::size_t N>
+constexpr std::size_t numOfLongOpts( const std::array<INFO_T, N>& rInfo )
+{
+   std::size_t n = 0;
+   for( std::size_t i = 0; i < N - 1; i++ )
+   {
+      if( rInfo[i].longOpt != nullptr )
+         n++;
+   }
+   return n;
+}
+
+/*-----------------------------------------------------------------------------
+ * Same rule as in initOptionTable().
+*/
+template <std::size_t N>
+constexpr std::size_t numOfSlots( const std::array<INFO_T, N>& rInfo )
+{
+   std::size_t n = 2;
+   while( n < (2 * numOfLongOpts( rInfo )) )
+      n *= 2;
+   return n;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+template <std::size_t N>
+constexpr bool hasNamelessOption( const std::array<INFO_T, N>& rInfo )
+{
+   for( std::size_t i = 0; i < N - 1; i++ )
+   {
+      if( (rInfo[i].shortOpt == 0) && (rInfo[i].longOpt == nullptr) )
+         return true;
+   }
+   return false;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+template <std::size_t N>
+constexpr bool hasDuplicateShortOption( const std::array<INFO_T, N>& rInfo )
+{
+   for( std::size_t i = 0; i < N - 1; i++ )
+   {
+      for( std::size_t j = i + 1; j < N - 1; j++ )
+      {
+         if( (rInfo[i].shortOpt != 0) && (rInfo[i].shortOpt == rInfo[j].shortOpt) )
+            return true;
+      }
+   }
+   return false;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+template <std::size_t N>
+constexpr bool hasDuplicateLongOption( const std::array<INFO_T, N>& rInfo )
+{
+   for( std::size_t i = 0; i < N - 1; i++ )
+   {
+      for( std::size_t j = i + 1; j < N - 1; j++ )
+      {
+         if( (rInfo[i].longOpt != nullptr) && (rInfo[j].longOpt != nullptr) &&
+             (compare( rInfo[i].longOpt, rInfo[j].longOpt ) == 0) )
+            return true;
+      }
+   }
+   return false;
+}
+
+/*-----------------------------------------------------------------------------
+ * Size of the pool of all long names, + 1 keeps it not empty.
+*/
+template <std::size_t N>
+constexpr std::size_t namePoolSize( const std::array<INFO_T, N>& rInfo )
+{
+   std::size_t n = 1;
+   for( std::size_t i = 0; i < N - 1; i++ )
+   {
+      if( rInfo[i].longOpt != nullptr )
+         n += length( rInfo[i].longOpt ) + 1;
+   }
+   return n;
+}
+
+/*!
+ * @brief Structure of arrays of OPTION_TABLE_T, indexed like the blocks.
+ */
+template <std::size_t N, std::size_t P>
+struct HOT_FIELDS_T
+{
+   std::array<char, N>          shortOpts;
+   std::array<std::uint32_t, N> hashes;
+   std::array<std::uint32_t, N> lengths;
+   std::array<std::uint32_t, N> nameOffsets;
+   std::array<char, P>          namePool;
+};
+
+/*-----------------------------------------------------------------------------
+ * Same content as made by initOptionTable().
+*/
+template <std::size_t P, std::size_t N>
+constexpr HOT_FIELDS_T<N, P> hotFields( const std::array<INFO_T, N>& rInfo )
+{
+   HOT_FIELDS_T<N, P> hot = {};
+   std::size_t offset = 0;
+   for( std::size_t i = 0; i < N - 1; i++ )
+   {
+      hot.shortOpts[i] = rInfo[i].shortOpt;
+      if( rInfo[i].longOpt == nullptr )
+         continue;
+      hot.hashes[i]      = hash( rInfo[i].longOpt );
+      hot.lengths[i]     = static_cast<std::uint32_t>( length( rInfo[i].longOpt ) );
+      hot.nameOffsets[i] = static_cast<std::uint32_t>( offset );
+      for( std::size_t j = 0; j <= hot.lengths[i]; j++ )
+         hot.namePool[offset++] = rInfo[i].longOpt[j];
+   }
+   return hot;
+}
+
+/*-----------------------------------------------------------------------------
+ * Block index per hash slot, N - 1 for a empty slot. Same linear probing
+ * as in initOptionTable(), so findLongOptionInTable() finds each name.
+*/
+template <std::size_t S, std::size_t N>
+constexpr std::array<std::size_t, S> slotIndex( const std::array<INFO_T, N>& rInfo )
+{
+   std::array<std::size_t, S> slots = {};
+   for( std::size_t i = 0; i < S; i++ )
+      slots[i] = N - 1;
+   for( std::size_t i = 0; i < N - 1; i++ )
+   {
+      if( rInfo[i].longOpt == nullptr )
+         continue;
+      std::size_t s = hash( rInfo[i].longOpt ) & (S - 1);
+      while( slots[s] != N - 1 )
+         s = (s + 1) & (S - 1);
+      slots[s] = i;
+   }
+   return slots;
+}
+
+/*-----------------------------------------------------------------------------
+ * Block index per character, N - 1 for a unused character.
+*/
+template <std::size_t N>
+constexpr std::array<std::size_t, 256> shortIndex( const std::array<INFO_T, N>& rInfo )
+{
+   std::array<std::size_t, 256> index = {};
+   for( std::size_t c = 0; c < 256; c++ )
+      index[c] = N - 1;
+   for( std::size_t i = 0; i < N - 1; i++ )
+   {
+      if( rInfo[i].shortOpt != 0 )
+         index[static_cast<unsigned char>( rInfo[i].shortOpt )] = i;
+   }
+   return index;
+}
+
+/*-----------------------------------------------------------------------------
+ * Indexes of the long options in the order of compare(), insertion sort
+ * because std::sort is not constexpr in C++17.
+*/
+template <std::size_t L, std::size_t N>
+constexpr std::array<std::size_t, L> prefixIndex( const std::array<INFO_T, N>& rInfo )
+{
+   std::array<std::size_t, L> index = {};
+   std::size_t n = 0;
+   if( L == 0 ) /* Prefix matching not enabled. */
+      return index;
+   for( std::size_t i = 0; i < N - 1; i++ )
+   {
+      if( rInfo[i].longOpt == nullptr )
+         continue;
+      std::size_t j = n++;
+      while( (j > 0) && (compare( rInfo[index[j - 1]].longOpt, rInfo[i].longOpt ) > 0) )
+      {
+         index[j] = index[j - 1];
+         j--;
+      }
+      index[j] = i;
+   }
+   return index;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+template <typename F, typename... A>
+inline int callOption( const F& rFunction, A&&... args )
+{
+   if constexpr( std::is_void_v<std::invoke_result_t<const F&, A...>> )
+   {
+      rFunction( std::forward<A>( args )... );
+      return 0;
+   }
+   else
+   {
+      return static_cast<int>( rFunction( std::forward<A>( args )... ) );
+   }
+}
+
+/*-----------------------------------------------------------------------------
+*/
+template <typename F>
+inline int invokeOption( const F& rFunction, BLOCK_FUNCTION_ARG_T& rArg )
+{
+   if constexpr( std::is_invocable_v<const F&, BLOCK_FUNCTION_ARG_T&> )
+      return callOption( rFunction, rArg );
+   else if constexpr( std::is_invocable_v<const F&, const char*> )
+      return callOption( rFunction, rArg.optArg );
+   else
+   {
+      static_assert( std::is_invocable_v<const F&>,
+                     "Option function has to accept (BLOCK_FUNCTION_ARG_T&),"
+                     " (const char*) or no argument!" );
+      return callOption( rFunction );
+   }
+}
+
+} // namespace detail
+
+/*!
+ * @brief The option table compiled by the C++ compiler.
+ *
+ * All members are static and constant initialized, so the table is ready
+ * before main() becomes invoked.
+ *
+ * COMPILED_T::blocks and COMPILED_T::table are usable by all functions of
+ * parse_opts.h which take a option block-list respectively a compiled
+ * option table, e.g. printOptionList( stdout, COMPILED_T<t>::blocks ).
+ * The option functions of the blocks forward to the lambdas of the table.
+ * @note Don't invoke freeOptionTable() for COMPILED_T::table.
+ * @param TABLE Reference to the constexpr object made by makeTable().
+ */
+template <const auto& TABLE>
+class COMPILED_T
+{
+   using TABLE_TYPE = std::remove_cv_t<std::remove_reference_t<decltype( TABLE )>>;
+
+   static constexpr std::size_t N = TABLE_TYPE::size;
+   static constexpr auto INFO = detail::makeInfo( TABLE, std::make_index_sequence<N>() );
+
+   static_assert( !detail::hasNamelessOption( INFO ),
+                  "Option without short and long name!" );
+   static_assert( !detail::hasDuplicateShortOption( INFO ),
+                  "Short option defined more than once!" );
+   static_assert( !detail::hasDuplicateLongOption( INFO ),
+                  "Long option defined more than once!" );
+
+   static constexpr std::size_t NUM_OF_SLOTS    = detail::numOfSlots( INFO );
+   static constexpr std::size_t NUM_OF_LONG     = detail::numOfLongOpts( INFO );
+   static constexpr std::size_t NUM_OF_PREFIXES = TABLE.uniquePrefixes? NUM_OF_LONG : 0;
+   static constexpr auto SLOT_INDEX   = detail::slotIndex<NUM_OF_SLOTS>( INFO );
+   static constexpr auto SHORT_INDEX  = detail::shortIndex( INFO );
+   static constexpr auto PREFIX_INDEX = detail::prefixIndex<NUM_OF_PREFIXES>( INFO );
+   static constexpr auto HOT          = detail::hotFields<detail::namePoolSize( INFO )>( INFO );
+
+   /*-----------------------------------------------------------------------*/
+   static int blockFunction( BLOCK_FUNCTION_ARG_T* pArg )
+   {
+      return dispatch( static_cast<std::size_t>( pArg->pCurrentBlock - blocks.data() ),
+                       *pArg, std::make_index_sequence<N>() );
+   }
+
+   /*-----------------------------------------------------------------------*/
+   template <std::size_t... I>
+   static constexpr std::array<OPTION_BLOCK_T, N + 1> makeBlocks( std::index_sequence<I...> )
+   {
+      /* The end marker has a NULL as option function. */
+      return {{ detail::makeBlock( blockFunction, INFO[I], static_cast<int>( I ) )...,
+                detail::makeBlock( nullptr, detail::NO_INFO, 0 ) }};
+   }
+
+   /*-----------------------------------------------------------------------*/
+   template <std::size_t... I>
+   static constexpr std::array<OPTION_HASH_SLOT_T, NUM_OF_SLOTS> makeSlots( std::index_sequence<I...> )
+   {
+      return {{ { (SLOT_INDEX[I] == N)? 0 : HOT.hashes[SLOT_INDEX[I]],
+                  (SLOT_INDEX[I] == N)? 0 :
+                     static_cast<std::uint32_t>( SLOT_INDEX[I] + 1 ) }... }};
+   }
+
+   /*-----------------------------------------------------------------------*/
+   template <std::size_t... I>
+   static constexpr std::array<const OPTION_BLOCK_T*, NUM_OF_PREFIXES>
+   makePrefixIndex( std::index_sequence<I...> )
+   {
+      return {{ &blocks[PREFIX_INDEX[I]]... }};
+   }
+
+   /*-----------------------------------------------------------------------*/
+   template <std::size_t... I>
+   static constexpr OPTION_TABLE_T makeOptionTable( std::index_sequence<I...> )
+   {
+      return { blocks.data(), slots.data(),
+               static_cast<std::uint32_t>( NUM_OF_SLOTS - 1 ),
+               static_cast<std::uint32_t>( NUM_OF_SLOTS ),
+               nullptr, 0,
+               static_cast<std::uint32_t>( N ),
+               HOT.shortOpts.data(), HOT.hashes.data(), HOT.lengths.data(),
+               HOT.nameOffsets.data(), HOT.namePool.data(),
+               { ((SHORT_INDEX[I] == N)? nullptr : &blocks[SHORT_INDEX[I]])... },
+               TABLE.uniquePrefixes? prefixes.data() : nullptr,
+               static_cast<std::uint32_t>( NUM_OF_PREFIXES ) };
+   }
+
+   /*-----------------------------------------------------------------------
+    * The generated dispatch: a compare chain which the compiler turns in a
+    * jump table, each lambda becomes inlined in its branch.
+    */
+   template <std::size_t... I>
+   static int dispatch( std::size_t index, BLOCK_FUNCTION_ARG_T& rArg,
+                        std::index_sequence<I...> )
+   {
+      int ret = 0;
+      (void)( ((index == I) &&
+               ((ret = detail::invokeOption( std::get<I>( TABLE.options ).function, rArg )), true)) || ... );
+      return ret;
+   }
+
+public:
+   /*!
+    * @brief Option block-list of the table, usable e.g. for printOptionList().
+    */
+   inline static std::array<OPTION_BLOCK_T, N + 1> blocks =
+      makeBlocks( std::make_index_sequence<N>() );
+
+   /*!
+    * @brief Hash index of the long options.
+    */
+   inline static const std::array<OPTION_HASH_SLOT_T, NUM_OF_SLOTS> slots =
+      makeSlots( std::make_index_sequence<NUM_OF_SLOTS>() );
+
+   /*!
+    * @brief Long options in sorted order when TABLE_T::uniquePrefixes is set.
+    */
+   inline static const std::array<const OPTION_BLOCK_T*, NUM_OF_PREFIXES> prefixes =
+      makePrefixIndex( std::make_index_sequence<NUM_OF_PREFIXES>() );
+
+   /*!
+    * @brief The compiled option table, usable for all functions of
+    *        parse_opts.h which take a OPTION_TABLE_T.
+    */
+   inline static const OPTION_TABLE_T table =
+      makeOptionTable( std::make_index_sequence<256>() );
+
+   /*!
+    * @brief Parses the command line until the next non-option argument,
+    *        the counterpart of parseCommandLineOptionsTableAt().
+    * @param offset Start-offset, initializer of the index for ppArgv[].
+    * @param argc The first argument of your main() function.
+    * @param ppArgv The second argument of your main() function.
+    * @param pUser Forwarding to BLOCK_FUNCTION_ARG_T::pUser.
+    * @param pErrorSink Optional error sink, nullptr for the default messages
+    *                   on stderr.
+    * @retval >= 0 Index of the next non-option argument, or argc when the
+    *              command line is completely parsed.
+    * @retval <0 Error, or the negative return value of a option lambda.
+    */
+   static int parse( int offset, int argc, char* const ppArgv[],
+                     void* pUser = nullptr,
+                     OPTION_ERROR_SINK_T* pErrorSink = nullptr )
+   {
+      OPTION_ITERATOR_T it;
+      BLOCK_FUNCTION_ARG_T arg = { argc, ppArgv, 0, nullptr, blocks.data(),
+                                   nullptr, pUser, &table, nullptr
+#ifndef CONFIG_CLOP_FREESTANDING
+                                 , nullptr
+#endif
+                                 };
+      bool error = false;
+      int ret;
+
+      initOptionIteratorTable( &it, offset, argc, ppArgv, &table );
+      it.pErrorSink = pErrorSink;
+
+      while( true )
+      {
+         switch( parseNextOption( &it ) )
+         {
+            case OPT_ITER_FOUND:
+            {
+               arg.argvIndex     = it.argvIndex;
+               arg.optArg        = it.optArg;
+               arg.pCurrentBlock = it.pBlock;
+               ret = dispatch( static_cast<std::size_t>( it.pBlock - blocks.data() ),
+                               arg, std::make_index_sequence<N>() );
+               if( ret < 0 )
+                  return ret;
+               if( ret > 0 )
+                  error = true;
+               if( arg.argvIndex != it.argvIndex )
+               { /* The lambda has consumed further arguments. */
+                  it.argvIndex = arg.argvIndex;
+                  it.nextIndex = arg.argvIndex + 1;
+               }
+               break;
+            }
+            case OPT_ITER_UNKNOWN:
+            {
+               error = true;
+               break;
+            }
+            case OPT_ITER_END:
+            {
+               return error? -1 : it.argvIndex;
+            }
+            default:
+            {
+               return -1;
+            }
+         }
+      }
+   }
+};
+
+} // namespace clop
+
+#endif /* ifndef _PARSE_OPTS_HPP */
+/*================================== EOF ====================================*/
@@ -0,0 +1,873 @@
+/*****************************************************************************/
+/*                                                                           */
+/*!     @brief Code generator for statically compiled option tables          */
+/*                                                                           */
+/*  Reads a option description file and emits a C source fragment which     */
+/*  contains the option block-list and the statically initialized compiled   */
+/*  option table of type OPTION_TABLE_T with a minimal perfect hash index    */
+/*  over the long option names and the short option dispatch table.          */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*! @file    clop_gen.c                                                      */
+/*! @see     parse_opts.h                                                    */
+/*! @author  Ulrich Becker                                                   */
+/*! @date    16.10.2026                                                      */
+/*****************************************************************************/
+/*
+ * MIT License
+ *
+ * Copyright (c) 2016 Ulrich Becker
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <parse_opts.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <ctype.h>
+
+#define MAX_LINE_LEN   4096
+#define MAX_SEED_TRIES (1U << 24)
+
+/*!----------------------------------------------------------------------------
+ * @brief One option of the description file.
+ */
+struct OPTION_DESC_T
+{
+   char*       function;
+   const char* hasArg;
+   char        shortOpt;
+   char*       longOpt;
+   char*       id;
+   char*       helpText;
+   uint32_t    hash;
+   uint32_t    length;
+   bool        inIndex;  //!<@brief false if the long name is a duplicate.
+   uint32_t    slot;
+};
+
+/*!----------------------------------------------------------------------------
+ * @brief The program variables which becomes modified by the options.
+ */
+struct GEN_T
+{
+   const char*           inputName;
+   const char*           outputName;
+   const char*           prefix;
+   bool                  externPrototypes;
+   bool                  uniquePrefixes;
+   struct OPTION_DESC_T* pOptions;
+   size_t                numOfOptions;
+   size_t                numOfLongOpts;
+   uint32_t*             pSeeds;
+   uint32_t              numOfSeeds;
+   uint32_t              numOfSlots;
+};
+
+/*-----------------------------------------------------------------------------
+*/
+static int optPrintHelp( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   printf( "Code generator for statically compiled option tables.\n\n"
+           "Usage: %s [options] <option description file>\nOptions:\n",
+           pArg->ppAgv[0] );
+   printOptionList( stdout, pArg->pOptBlockList );
+   printf( "Format of the description file, one option per line:\n"
+           "  <callback> <NO_ARG|REQUIRED_ARG|OPTIONAL_ARG> <short> <long> <id> <help>\n"
+           "<short>, <long> and <id> can be \"-\" if not used.\n"
+           "<help> is the rest of the line as C string literal or \"-\".\n"
+           "Empty lines and lines beginning with '#' will ignored.\n" );
+   exit( EXIT_SUCCESS );
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optOutput( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   ((struct GEN_T*)pArg->pUser)->outputName = pArg->optArg;
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optPrefix( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   ((struct GEN_T*)pArg->pUser)->prefix = pArg->optArg;
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optExtern( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   ((struct GEN_T*)pArg->pUser)->externPrototypes = true;
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int optUniquePrefixes( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   ((struct GEN_T*)pArg->pUser)->uniquePrefixes = true;
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static char* nextField( char** ppLine )
+{
+   char* pStart = *ppLine;
+
+   while( isspace( (unsigned char)*pStart ) )
+      pStart++;
+   if( *pStart == '\0' )
+      return NULL;
+   *ppLine = pStart;
+   while( (**ppLine != '\0') && !isspace( (unsigned char)**ppLine ) )
+      (*ppLine)++;
+   if( **ppLine != '\0' )
+   {
+      **ppLine = '\0';
+      (*ppLine)++;
+   }
+   return pStart;
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static char* duplicate( const char* str )
+{
+   char* pNew = malloc( strlen( str ) + 1 );
+   if( pNew == NULL )
+   {
+      fprintf( stderr, "clop-gen: out of memory\n" );
+      exit( EXIT_FAILURE );
+   }
+   return strcpy( pNew, str );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int readDescription( struct GEN_T* pGen, FILE* pFile )
+{
+   char line[MAX_LINE_LEN];
+   char* pLine;
+   char* pField;
+   struct OPTION_DESC_T* pOpt;
+   size_t capacity = 0;
+   size_t len;
+   unsigned int lineNumber = 0;
+
+   while( fgets( line, sizeof( line ), pFile ) != NULL )
+   {
+      lineNumber++;
+      len = strlen( line );
+      while( (len > 0) && isspace( (unsigned char)line[len-1] ) )
+         line[--len] = '\0';
+
+      pLine = line;
+      pField = nextField( &pLine );
+      if( (pField == NULL) || (*pField == '#') )
+         continue;
+
+      if( pGen->numOfOptions == capacity )
+      {
+         capacity = (capacity == 0)? 64 : capacity * 2;
+         pGen->pOptions = realloc( pGen->pOptions,
+                                   capacity * sizeof( struct OPTION_DESC_T ) );
+         if( pGen->pOptions == NULL )
+         {
+            fprintf( stderr, "clop-gen: out of memory\n" );
+            return -1;
+         }
+      }
+      pOpt = &pGen->pOptions[pGen->numOfOptions];
+      memset( pOpt, 0, sizeof( *pOpt ) );
+      pOpt->function = duplicate( pField );
+
+      pField = nextField( &pLine );
+      if( pField == NULL )
+         goto L_FORMAT_ERROR;
+      if( strcmp( pField, "NO_ARG" ) == 0 )
+         pOpt->hasArg = "NO_ARG";
+      else if( strcmp( pField, "REQUIRED_ARG" ) == 0 )
+         pOpt->hasArg = "REQUIRED_ARG";
+      else if( strcmp( pField, "OPTIONAL_ARG" ) == 0 )
+         pOpt->hasArg = "OPTIONAL_ARG";
+      else
+         goto L_FORMAT_ERROR;
+
+      pField = nextField( &pLine );
+      if( (pField == NULL) || (pField[1] != '\0') )
+         goto L_FORMAT_ERROR;
+      if( pField[0] != '-' )
+         pOpt->shortOpt = pField[0];
+
+      pField = nextField( &pLine );
+      if( (pField == NULL) || (strpbrk( pField, "\"\\=" ) != NULL) )
+         goto L_FORMAT_ERROR;
+      if( strcmp( pField, "-" ) != 0 )
+      {
+         pOpt->longOpt = duplicate( pField );
+         pOpt->length  = strlen( pField );
+         pOpt->hash    = optionNameHash( pField, pOpt->length );
+      }
+
+      pField = nextField( &pLine );
+      if( pField == NULL )
+         goto L_FORMAT_ERROR;
+      if( strcmp( pField, "-" ) != 0 )
+         pOpt->id = duplicate( pField );
+
+      while( isspace( (unsigned char)*pLine ) )
+         pLine++;
+      if( (*pLine != '\0') && (strcmp( pLine, "-" ) != 0) )
+      {
+         if( *pLine != '"' )
+            goto L_FORMAT_ERROR;
+         pOpt->helpText = duplicate( pLine );
+      }
+
+      if( (pOpt->shortOpt == 0) && (pOpt->longOpt == NULL) )
+      {
+         fprintf( stderr, "%s:%u: short and long option are missing\n",
+                  pGen->inputName, lineNumber );
+         return -1;
+      }
+      pGen->numOfOptions++;
+   }
+   return 0;
+
+L_FORMAT_ERROR:
+   fprintf( stderr, "%s:%u: format error\n", pGen->inputName, lineNumber );
+   return -1;
+}
+
+/*-----------------------------------------------------------------------------
+ * Placeholder of the callback functions for validateOptionBlockList().
+ */
+static int optPlaceholder( struct BLOCK_FUNCTION_ARG_T* pArg )
+{
+   (void)pArg;
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ * Checks the options by validateOptionBlockList() like initOptionTable()
+ * and removes duplicated names from the index, the first one wins
+ * like in the parser.
+ */
+static int markDuplicates( struct GEN_T* pGen )
+{
+   struct OPTION_BLOCK_T* pBlocks;
+   struct OPTION_ERROR_T* pErrors;
+   /* At most one finding of the short and one of the long name per option. */
+   struct OPTION_ERROR_SINK_T sink = { .capacity = 2 * pGen->numOfOptions };
+   char message[512];
+   size_t i;
+
+   pBlocks = calloc( pGen->numOfOptions + 1, sizeof( struct OPTION_BLOCK_T ) );
+   pErrors = calloc( sink.capacity + 1, sizeof( struct OPTION_ERROR_T ) );
+   if( (pBlocks == NULL) || (pErrors == NULL) )
+   {
+      fprintf( stderr, "clop-gen: out of memory\n" );
+      return -1;
+   }
+   for( i = 0; i < pGen->numOfOptions; i++ )
+   {
+      struct OPTION_DESC_T* pOpt = &pGen->pOptions[i];
+      const struct OPTION_BLOCK_T block =
+      {
+         .optFunction = optPlaceholder,
+         .shortOpt    = pOpt->shortOpt,
+         .longOpt     = pOpt->longOpt,
+         .hasArg      = (strcmp( pOpt->hasArg, "REQUIRED_ARG" ) == 0)? REQUIRED_ARG :
+                        (strcmp( pOpt->hasArg, "OPTIONAL_ARG" ) == 0)? OPTIONAL_ARG :
+                                                                      NO_ARG
+      };
+      /* The members of the blocks are read-only. */
+      memcpy( &pBlocks[i], &block, sizeof( block ) );
+      pOpt->inIndex = (pOpt->longOpt != NULL);
+   }
+
+   sink.pErrors = pErrors;
+   if( validateOptionBlockList( pBlocks, &sink ) < 0 )
+   {
+      fprintf( stderr, "clop-gen: out of memory\n" );
+      return -1;
+   }
+   for( i = 0; i < sink.count; i++ )
+   {
+      renderOptionError( message, sizeof( message ), "clop-gen: warning",
+                         &pErrors[i] );
+      fputs( message, stderr );
+      if( pErrors[i].code == OPT_ERR_DUPLICATE_LONG_OPTION )
+         pGen->pOptions[pErrors[i].argvIndex].inIndex = false;
+   }
+
+   for( i = 0; i < pGen->numOfOptions; i++ )
+   {
+      if( pGen->pOptions[i].inIndex )
+         pGen->numOfLongOpts++;
+   }
+   free( pErrors );
+   free( pBlocks );
+   return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ * Hash and displace: the keys are distributed in buckets by the lower bits
+ * of the hash value, the buckets becomes placed in descending order of their
+ * size by searching a seed for each bucket which maps all keys of the
+ * bucket into free slots.
+ */
+struct BUCKET_T
+{
+   uint32_t index;
+   uint32_t size;
+   uint32_t start; //!<@brief Start of the keys of this bucket in pKeys.
+};
+
+static int comparBucketSize( const void* pA, const void* pB )
+{
+   uint32_t a = ((const struct BUCKET_T*)pA)->size;
+   uint32_t b = ((const struct BUCKET_T*)pB)->size;
+   return (a < b) - (a > b);
+}
+
+static bool buildPerfectHash( struct GEN_T* pGen, uint32_t numOfSeeds )
+{
+   struct BUCKET_T* pBuckets;
+   struct OPTION_DESC_T** ppKeys;
+   uint32_t* pFill;
+   bool*     pUsed;
+   uint32_t  b, k, seed, slot, start;
+   size_t    i;
+   bool      ok = true;
+
+   pGen->numOfSlots = pGen->numOfLongOpts;
+   pGen->numOfSeeds = numOfSeeds;
+   pGen->pSeeds = calloc( numOfSeeds, sizeof( uint32_t ) );
+   pBuckets     = calloc( numOfSeeds, sizeof( struct BUCKET_T ) );
+   pFill        = calloc( numOfSeeds, sizeof( uint32_t ) );
+   ppKeys       = malloc( pGen->numOfLongOpts * sizeof( struct OPTION_DESC_T* ) );
+   pUsed        = calloc( pGen->numOfSlots, sizeof( bool ) );
+   if( (pGen->pSeeds == NULL) || (pBuckets == NULL) || (pFill == NULL) ||
+       (ppKeys == NULL) || (pUsed == NULL) )
+   {
+      fprintf( stderr, "clop-gen: out of memory\n" );
+      exit( EXIT_FAILURE );
+   }
+
+   for( i = 0; i < pGen->numOfOptions; i++ )
+      if( pGen->pOptions[i].inIndex )
+         pBuckets[pGen->pOptions[i].hash & (numOfSeeds - 1)].size++;
+   for( b = 0, start = 0; b < numOfSeeds; b++ )
+   {
+      pBuckets[b].index = b;
+      pBuckets[b].start = start;
+      start += pBuckets[b].size;
+   }
+   for( i = 0; i < pGen->numOfOptions; i++ )
+   {
+      if( !pGen->pOptions[i].inIndex )
+         continue;
+      b = pGen->pOptions[i].hash & (numOfSeeds - 1);
+      ppKeys[pBuckets[b].start + pFill[b]++] = &pGen->pOptions[i];
+   }
+   qsort( pBuckets, numOfSeeds, sizeof( struct BUCKET_T ), comparBucketSize );
+
+   for( b = 0; (b < numOfSeeds) && (pBuckets[b].size > 0) && ok; b++ )
+   {
+      struct OPTION_DESC_T** ppBucket = &ppKeys[pBuckets[b].start];
+      for( seed = 0; seed < MAX_SEED_TRIES; seed++ )
+      {
+         for( k = 0; k < pBuckets[b].size; k++ )
+         {
+            slot = optionSeedHash( ppBucket[k]->hash, seed ) % pGen->numOfSlots;
+            if( pUsed[slot] )
+               break;
+            pUsed[slot] = true;
+            ppBucket[k]->slot = slot;
+         }
+         if( k == pBuckets[b].size )
+            break;
+         /* Collision: undo the slots of this try. */
+         while( k-- > 0 )
+            pUsed[ppBucket[k]->slot] = false;
+      }
+      if( seed == MAX_SEED_TRIES )
+         ok = false;
+      else
+         pGen->pSeeds[pBuckets[b].index] = seed;
+   }
+
+   free( pBuckets );
+   free( pFill );
+   free( ppKeys );
+   free( pUsed );
+   if( !ok )
+   {
+      free( pGen->pSeeds );
+      pGen->pSeeds = NULL;
+   }
+   return ok;
+}
+
+/*-----------------------------------------------------------------------------
+ * Two different names with the same hash value makes a perfect hash
+ * impossible.
+ */
+static int comparHash( const void* pA, const void* pB )
+{
+   uint32_t a = *(const uint32_t*)pA;
+   uint32_t b = *(const uint32_t*)pB;
+   return (a > b) - (a < b);
+}
+
+static bool hasHashCollision( const struct GEN_T* pGen )
+{
+   uint32_t* pHashes = malloc( pGen->numOfLongOpts * sizeof( uint32_t ) );
+   size_t i, n = 0;
+   bool ret = false;
+
+   if( pHashes == NULL )
+   {
+      fprintf( stderr, "clop-gen: out of memory\n" );
+      exit( EXIT_FAILURE );
+   }
+   for( i = 0; i < pGen->numOfOptions; i++ )
+      if( pGen->pOptions[i].inIndex )
+         pHashes[n++] = pGen->pOptions[i].hash;
+   qsort( pHashes, n, sizeof( uint32_t ), comparHash );
+   for( i = 1; i < n; i++ )
+      if( pHashes[i] == pHashes[i-1] )
+         ret = true;
+   free( pHashes );
+   return ret;
+}
+
+/*-----------------------------------------------------------------------------
+ * Fallback if no perfect hash is possible (identical hash values):
+ * open addressing like initOptionTable().
+ */
+static void buildOpenAddressing( struct GEN_T* pGen )
+{
+   size_t i;
+   uint32_t slot;
+   bool* pUsed;
+
+   pGen->numOfSlots = 2;
+   while( pGen->numOfSlots < (2 * pGen->numOfLongOpts) )
+      pGen->numOfSlots *= 2;
+   pUsed = calloc( pGen->numOfSlots, sizeof( bool ) );
+   if( pUsed == NULL )
+   {
+      fprintf( stderr, "clop-gen: out of memory\n" );
+      exit( EXIT_FAILURE );
+   }
+   for( i = 0; i < pGen->numOfOptions; i++ )
+   {
+      struct OPTION_DESC_T* pOpt = &pGen->pOptions[i];
+      if( !pOpt->inIndex )
+         continue;
+      slot = pOpt->hash & (pGen->numOfSlots - 1);
+      while( pUsed[slot] )
+         slot = (slot + 1) & (pGen->numOfSlots - 1);
+      pUsed[slot] = true;
+      pOpt->slot = slot;
+   }
+   free( pUsed );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void writeCharLiteral( FILE* pOut, char c )
+{
+   if( (c == '\'') || (c == '\\') )
+      fprintf( pOut, "'\\%c'", c );
+   else if( isprint( (unsigned char)c ) )
+      fprintf( pOut, "'%c'", c );
+   else
+      fprintf( pOut, "'\\x%02X'", (uint8_t)c );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static int compareLongOpt( const void* p1, const void* p2 )
+{
+   return strcmp( (*(struct OPTION_DESC_T* const*)p1)->longOpt,
+                  (*(struct OPTION_DESC_T* const*)p2)->longOpt );
+}
+
+/*-----------------------------------------------------------------------------
+ * Sorted index for enableOptionPrefixMatching(), made at compile time.
+ */
+static size_t writePrefixIndex( struct GEN_T* pGen, FILE* pOut )
+{
+   struct OPTION_DESC_T** ppSorted;
+   size_t i, n = 0;
+
+   ppSorted = malloc( (pGen->numOfLongOpts + 1) * sizeof( struct OPTION_DESC_T* ) );
+   if( ppSorted == NULL )
+   {
+      fprintf( stderr, "clop-gen: out of memory\n" );
+      exit( EXIT_FAILURE );
+   }
+   for( i = 0; i < pGen->numOfOptions; i++ )
+      if( pGen->pOptions[i].inIndex )
+         ppSorted[n++] = &pGen->pOptions[i];
+   qsort( ppSorted, n, sizeof( struct OPTION_DESC_T* ), compareLongOpt );
+
+   fprintf( pOut, "static const struct OPTION_BLOCK_T* const %sPrefixIndex[%zu] =\n{\n",
+            pGen->prefix, (n == 0)? 1 : n );
+   for( i = 0; i < n; i++ )
+      fprintf( pOut, "   &%sBlockList[%zu], /* --%s */\n", pGen->prefix,
+               (size_t)(ppSorted[i] - pGen->pOptions), ppSorted[i]->longOpt );
+   fprintf( pOut, "};\n\n" );
+   free( ppSorted );
+   return n;
+}
+
+/*-----------------------------------------------------------------------------
+ * Writes the structure of arrays of the fields which the lookups need,
+ * indexed like the block-list.
+ */
+static void writeHotFields( struct GEN_T* pGen, FILE* pOut )
+{
+   const char* p = pGen->prefix;
+   const size_t n = (pGen->numOfOptions == 0)? 1 : pGen->numOfOptions;
+   size_t i;
+   uint32_t offset;
+
+   fprintf( pOut, "static const char %sShortOpts[%zu] =\n{", p, n );
+   for( i = 0; i < pGen->numOfOptions; i++ )
+   {
+      fprintf( pOut, "%s", ((i % 8) == 0)? "\n   " : " " );
+      if( pGen->pOptions[i].shortOpt != 0 )
+         writeCharLiteral( pOut, pGen->pOptions[i].shortOpt );
+      else
+         fprintf( pOut, "0" );
+      fprintf( pOut, "," );
+   }
+   fprintf( pOut, "\n};\n\n" );
+
+   fprintf( pOut, "static const uint32_t %sHashes[%zu] =\n{", p, n );
+   for( i = 0; i < pGen->numOfOptions; i++ )
+      fprintf( pOut, "%s0x%08XU,", ((i % 6) == 0)? "\n   " : " ",
+               (pGen->pOptions[i].longOpt != NULL)? pGen->pOptions[i].hash : 0 );
+   fprintf( pOut, "\n};\n\n" );
+
+   fprintf( pOut, "static const uint32_t %sLengths[%zu] =\n{", p, n );
+   for( i = 0; i < pGen->numOfOptions; i++ )
+      fprintf( pOut, "%s%u,", ((i % 12) == 0)? "\n   " : " ",
+               (pGen->pOptions[i].longOpt != NULL)? pGen->pOptions[i].length : 0 );
+   fprintf( pOut, "\n};\n\n" );
+
+   offset = 0;
+   fprintf( pOut, "static const uint32_t %sNameOffsets[%zu] =\n{", p, n );
+   for( i = 0; i < pGen->numOfOptions; i++ )
+   {
+      fprintf( pOut, "%s%u,", ((i % 12) == 0)? "\n   " : " ",
+               (pGen->pOptions[i].longOpt != NULL)? offset : 0 );
+      if( pGen->pOptions[i].longOpt != NULL )
+         offset += pGen->pOptions[i].length + 1;
+   }
+   fprintf( pOut, "\n};\n\n" );
+
+   fprintf( pOut, "static const char %sNamePool[] =\n", p );
+   for( i = 0; i < pGen->numOfOptions; i++ )
+   {
+      if( pGen->pOptions[i].longOpt != NULL )
+         fprintf( pOut, "   \"%s\\0\"\n", pGen->pOptions[i].longOpt );
+   }
+   fprintf( pOut, "   \"\";\n\n" );
+}
+
+/*-----------------------------------------------------------------------------
+*/
+static void writeSource( struct GEN_T* pGen, FILE* pOut )
+{
+   size_t i, j;
+   size_t numOfPrefixes = 0;
+   const char* p = pGen->prefix;
+   struct OPTION_DESC_T** ppSlots;
+
+   fprintf( pOut,
+            "/*\n"
+            " * Generated by clop-gen from \"%s\".\n"
+            " * Don't edit this file, edit the description file instead!\n"
+            " *\n"
+            " * Include this file after the definitions of the callback functions.\n"
+            " */\n"
+            "#include <parse_opts.h>\n\n",
+            pGen->inputName );
+
+   if( pGen->externPrototypes )
+   {
+      for( i = 0; i < pGen->numOfOptions; i++ )
+      {
+         for( j = 0; j < i; j++ )
+            if( strcmp( pGen->pOptions[j].function, pGen->pOptions[i].function ) == 0 )
+               break;
+         if( j == i )
+            fprintf( pOut, "int %s( struct BLOCK_FUNCTION_ARG_T* pArg );\n",
+                     pGen->pOptions[i].function );
+      }
+      fprintf( pOut, "\n" );
+   }
+
+   fprintf( pOut, "static struct OPTION_BLOCK_T %sBlockList[] =\n{\n", p );
+   for( i = 0; i < pGen->numOfOptions; i++ )
+   {
+      struct OPTION_DESC_T* pOpt = &pGen->pOptions[i];
+      fprintf( pOut, "   {\n"
+                     "      .optFunction = %s,\n"
+                     "      .hasArg      = %s,\n", pOpt->function, pOpt->hasArg );
+      if( pOpt->id != NULL )
+         fprintf( pOut, "      .id          = %s,\n", pOpt->id );
+      if( pOpt->shortOpt != 0 )
+      {
+         fprintf( pOut, "      .shortOpt    = " );
+         writeCharLiteral( pOut, pOpt->shortOpt );
+         fprintf( pOut, ",\n" );
+      }
+      if( pOpt->longOpt != NULL )
+         fprintf( pOut, "      .longOpt     = \"%s\",\n", pOpt->longOpt );
+      if( pOpt->helpText != NULL )
+         fprintf( pOut, "      .helpText    = %s\n", pOpt->helpText );
+      fprintf( pOut, "   },\n" );
+   }
+   fprintf( pOut, "   OPTION_BLOCKLIST_END_MARKER\n};\n\n" );
+
+   ppSlots = calloc( pGen->numOfSlots, sizeof( struct OPTION_DESC_T* ) );
+   if( ppSlots == NULL )
+   {
+      fprintf( stderr, "clop-gen: out of memory\n" );
+      exit( EXIT_FAILURE );
+   }
+   for( i = 0; i < pGen->numOfOptions; i++ )
+      if( pGen->pOptions[i].inIndex )
+         ppSlots[pGen->pOptions[i].slot] = &pGen->pOptions[i];
+
+   fprintf( pOut, "static const struct OPTION_HASH_SLOT_T %sSlots[%u] =\n{\n",
+            p, pGen->numOfSlots );
+   for( i = 0; i < pGen->numOfSlots; i++ )
+   {
+      if( ppSlots[i] == NULL )
+         fprintf( pOut, "   { 0, 0 },\n" );
+      else
+         fprintf( pOut, "   { 0x%08XU, %zu }, /* --%s */\n",
+                  ppSlots[i]->hash, (size_t)(ppSlots[i] - pGen->pOptions) + 1,
+                  ppSlots[i]->longOpt );
+   }
+   fprintf( pOut, "};\n\n" );
+   free( ppSlots );
+
+   writeHotFields( pGen, pOut );
+
+   if( pGen->pSeeds != NULL )
+   {
+      fprintf( pOut, "static const uint32_t %sSeeds[%u] =\n{", p, pGen->numOfSeeds );
+      for( i = 0; i < pGen->numOfSeeds; i++ )
+         fprintf( pOut, "%s0x%08XU,", ((i % 6) == 0)? "\n   " : " ", pGen->pSeeds[i] );
+      fprintf( pOut, "\n};\n\n" );
+   }
+
+   if( pGen->uniquePrefixes )
+      numOfPrefixes = writePrefixIndex( pGen, pOut );
+
+   fprintf( pOut, "static const struct OPTION_TABLE_T %sTable =\n{\n"
+                  "   .pOptBlockList = %sBlockList,\n"
+                  "   .pSlots        = %sSlots,\n"
+                  "   .numOfSlots    = %uU,\n"
+                  "   .numOfBlocks   = %zuU,\n"
+                  "   .pShortOpts    = %sShortOpts,\n"
+                  "   .pHashes       = %sHashes,\n"
+                  "   .pLengths      = %sLengths,\n"
+                  "   .pNameOffsets  = %sNameOffsets,\n"
+                  "   .pNamePool     = %sNamePool,\n",
+            p, p, p, pGen->numOfSlots, pGen->numOfOptions, p, p, p, p, p );
+   if( pGen->pSeeds != NULL )
+      fprintf( pOut, "   .pSeeds        = %sSeeds,\n"
+                     "   .seedMask      = %uU,\n", p, pGen->numOfSeeds - 1 );
+   else
+      fprintf( pOut, "   .slotMask      = %uU,\n", pGen->numOfSlots - 1 );
+   if( pGen->uniquePrefixes )
+      fprintf( pOut, "   .ppPrefixIndex = %sPrefixIndex,\n"
+                     "   .numOfPrefixes = %zuU,\n", p, numOfPrefixes );
+   fprintf( pOut, "   .shortOptIndex =\n   {\n" );
+   for( i = 0; i < 256; i++ )
+   {
+      for( j = 0; j < pGen->numOfOptions; j++ )
+         if( (uint8_t)pGen->pOptions[j].shortOpt == i && (i != 0) )
+            break;
+      if( j == pGen->numOfOptions )
+         continue;
+      fprintf( pOut, "      [%3zu] = &%sBlockList[%zu], /* ", i, p, j );
+      writeCharLiteral( pOut, pGen->pOptions[j].shortOpt );
+      fprintf( pOut, " */\n" );
+   }
+   fprintf( pOut, "   }\n};\n\n" );
+
+   fprintf( pOut,
+            "static inline int %sParseAt( int offset, int argc, char* const ppAgv[], void* pUser )\n"
+            "{\n"
+            "   return parseCommandLineOptionsTableAt( offset, argc, ppAgv, &%sTable, pUser );\n"
+            "}\n\n"
+            "static inline int %sParse( int argc, char* const ppAgv[], void* pUser )\n"
+            "{\n"
+            "   return parseCommandLineOptionsTableAt( 1, argc, ppAgv, &%sTable, pUser );\n"
+            "}\n\n"
+            "/*================================== EOF ====================================*/\n",
+            p, p, p, p );
+}
+
+/*!============================================================================
+ */
+int main( int argc, char** ppArgv )
+{
+   struct OPTION_BLOCK_T blockList[] =
+   {
+      {
+         .optFunction = optPrintHelp,
+         .shortOpt    = 'h',
+         .longOpt     = "help",
+         .helpText    = "Print this help and exit"
+      },
+      {
+         .optFunction = optOutput,
+         .hasArg      = REQUIRED_ARG,
+         .shortOpt    = 'o',
+         .longOpt     = "output",
+         .helpText    = "Name of the generated C file, default is stdout"
+      },
+      {
+         .optFunction = optPrefix,
+         .hasArg      = REQUIRED_ARG,
+         .shortOpt    = 'p',
+         .longOpt     = "prefix",
+         .helpText    = "Prefix of the generated identifiers, default is \"opt\"\n"
+                        "e.g.: optBlockList, optTable, optParse()"
+      },
+      {
+         .optFunction = optExtern,
+         .shortOpt    = 'e',
+         .longOpt     = "extern",
+         .helpText    = "Emit prototypes of the callback functions, so that\n"
+                        "the generated file can be compiled separately"
+      },
+      {
+         .optFunction = optUniquePrefixes,
+         .shortOpt    = 'u',
+         .longOpt     = "unique-prefixes",
+         .helpText    = "Emit a sorted index of the long options, so that\n"
+                        "unique prefixes becomes accepted, e.g. --verb for\n"
+                        "--verbose (see enableOptionPrefixMatching())"
+      },
+      OPTION_BLOCKLIST_END_MARKER
+   };
+
+   struct GEN_T gen =
+   {
+      .prefix = "opt"
+   };
+   struct OPTION_CONTEXT_T context = { .pOptBlockList = blockList };
+   FILE* pIn;
+   FILE* pOut = stdout;
+   uint32_t numOfSeeds;
+   int i;
+
+   /* Request of the shell completion scripts. */
+   if( completeCommandLine( argc, ppArgv, &context, NULL, NULL ) )
+      return EXIT_SUCCESS;
+
+   for( i = 1; i < argc; i++ )
+   {
+      i = parseCommandLineOptionsAt( i, argc, ppArgv, blockList, &gen );
+      if( i < 0 )
+         return EXIT_FAILURE;
+      if( i >= argc )
+         break;
+      if( gen.inputName != NULL )
+      {
+         fprintf( stderr, "%s: only one description file expected\n", ppArgv[0] );
+         return EXIT_FAILURE;
+      }
+      gen.inputName = ppArgv[i];
+   }
+   if( gen.inputName == NULL )
+   {
+      fprintf( stderr, "%s: missing description file\n", ppArgv[0] );
+      return EXIT_FAILURE;
+   }
+
+   pIn = fopen( gen.inputName, "r" );
+   if( pIn == NULL )
+   {
+      perror( gen.inputName );
+      return EXIT_FAILURE;
+   }
+   i = readDescription( &gen, pIn );
+   fclose( pIn );
+   if( i != 0 )
+      return EXIT_FAILURE;
+
+   if( markDuplicates( &gen ) != 0 )
+      return EXIT_FAILURE;
+
+   if( (gen.numOfLongOpts == 0) || hasHashCollision( &gen ) )
+      buildOpenAddressing( &gen );
+   else
+   {  /* Approximately four keys per bucket. */
+      numOfSeeds = 1;
+      while( (numOfSeeds * 4) < gen.numOfLongOpts )
+         numOfSeeds *= 2;
+      while( !buildPerfectHash( &gen, numOfSeeds ) )
+      {
+         if( numOfSeeds >= gen.numOfLongOpts )
+         {
+            fprintf( stderr, "clop-gen: warning: no perfect hash found, "
+                             "using open addressing\n" );
+            buildOpenAddressing( &gen );
+            break;
+         }
+         numOfSeeds *= 2;
+      }
+   }
+
+   if( gen.outputName != NULL )
+   {
+      pOut = fopen( gen.outputName, "w" );
+      if( pOut == NULL )
+      {
+         perror( gen.outputName );
+         return EXIT_FAILURE;
+      }
+   }
+   writeSource( &gen, pOut );
+   if( pOut != stdout )
+      fclose( pOut );
+
+   return EXIT_SUCCESS;
+}
+
+/*================================== EOF ====================================*/